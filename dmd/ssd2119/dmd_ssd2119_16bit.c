@@ -1,873 +1,1292 @@
- /*************************************************************************//**
- * @file dmd_ssd2119.c
- * @brief Dot matrix display driver for LCD controller SSD2119
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-#include <stdint.h>
-#include <stdlib.h>
-#include <stdio.h>
-#include "dmd_ssd2119.h"
-#include "dmd_ssd2119_registers.h"
-#include "dmdif_ssd2119_ebi.h"
-
-/** Dimensions of the display */
-DMD_DisplayGeometry dimensions;
-
-/* Local variables */
-static uint32_t initialized = 0;
-static uint16_t rcDriverOutputControl;
-
-/* Local function prototypes */
-static uint32_t colorTransform24To16bpp( uint8_t red, uint8_t green, uint8_t blue);
-static void colorTransform16To24bpp(uint32_t color,
-                                    uint8_t *red, uint8_t *green, uint8_t *blue);
-/**************************************************************************//**
-*  @brief
-*  Initializes the LCD display
-*
-*  @param cmdRegAddr
-*  The address in memory where data to the command register in the display
-*  controller are written
-*  @param dataRegAddr
-*  The address in memory where data to the data register in the display
-*  controller are written
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_init(uint32_t cmdRegAddr, uint32_t dataRegAddr){
-
-  EMSTATUS stat;
-  uint16_t data;
-
-  /* Initialize register cache variables */
-  rcDriverOutputControl = 0;
-
-  /* Initialize DMD interface */
-  if ((stat = DMDIF_init(cmdRegAddr, dataRegAddr)) != DMD_OK)
-  {
-    return stat;
-  }
-
-  /* Initialization sequence, see UMSH-8252MD-T page 13 */
-
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_VCOM_OTP_1, 0x0006); */
-  DMDIF_writeReg(DMD_SSD2119_VCOM_OTP_1, 0x0006);
-
-  /* Start oscillation */
-  data = DMD_SSD2119_OSCILLATION_START_OSCEN;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_OSCILLATION_START, data); */
-  DMDIF_writeReg(DMD_SSD2119_OSCILLATION_START, data);
-
-  /* Exit sleep mode */
-  data = 0;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_SLEEP_MODE_1, data); */
-  DMDIF_writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
-
-  /* Display control */
-  data  = DMD_SSD2119_DISPLAY_CONTROL_DTE;
-  data |= DMD_SSD2119_DISPLAY_CONTROL_GON;
-  data |= DMD_SSD2119_DISPLAY_CONTROL_D1;
-  data |= DMD_SSD2119_DISPLAY_CONTROL_D0;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_DISPLAY_CONTROL, data); */
-  DMDIF_writeReg(DMD_SSD2119_DISPLAY_CONTROL, data);
-
-  /* Entry mode */
-  data  = DMD_SSD2119_ENTRY_MODE_DFM_65K << DMD_SSD2119_ENTRY_MODE_DFM_SHIFT;
-  data |= DMD_SSD2119_ENTRY_MODE_DENMODE;
-  data |= DMD_SSD2119_ENTRY_MODE_WMODE;
-  data |= DMD_SSD2119_ENTRY_MODE_NOSYNC;
-  data |= DMD_SSD2119_ENTRY_MODE_TY_TYPE_B << DMD_SSD2119_ENTRY_MODE_TY_SHIFT;
-  data |= DMD_SSD2119_ENTRY_MODE_ID1;
-  data |= DMD_SSD2119_ENTRY_MODE_ID0;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_ENTRY_MODE, data); */
-  DMDIF_writeReg(DMD_SSD2119_ENTRY_MODE, data);
-
-  /* LCD AC control */
-  data  = DMD_SSD2119_LCD_AC_CONTROL_BC;
-  data |= DMD_SSD2119_LCD_AC_CONTROL_EOR;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_LCD_AC_CONTROL, data); */
-  DMDIF_writeReg(DMD_SSD2119_LCD_AC_CONTROL, data);
-
-  /* Power control */
-  data  = 0x06 << DMD_SSD2119_POWER_CONTROL_1_DCT_SHIFT;
-  data |= 0x05 << DMD_SSD2119_POWER_CONTROL_1_BT_SHIFT;
-  data |= 0x03 << DMD_SSD2119_POWER_CONTROL_1_DC_SHIFT;
-  data |= 0x04 << DMD_SSD2119_POWER_CONTROL_1_AP_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_1, data); */
-  DMDIF_writeReg(DMD_SSD2119_POWER_CONTROL_1, data);
-
-  /* Driver output control */
-  data                  = DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
-  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_REV;
-  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_GD;
-  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
-  data                 |= (DMD_VERTICAL_SIZE - 1) << DMD_SSD2119_DRIVER_OUTPUT_CONTROL_MUX_SHIFT;
-  rcDriverOutputControl = data;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_DRIVER_OUTPUT_CONTROL, data); */
-  DMDIF_writeReg(DMD_SSD2119_DRIVER_OUTPUT_CONTROL, data);
-
-  /* Power Control */
-  data = 0x05 << DMD_SSD2119_POWER_CONTROL_2_VRC_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_2, data); */
-  DMDIF_writeReg(DMD_SSD2119_POWER_CONTROL_2, data);
-
-  data = 0x0D << DMD_SSD2119_POWER_CONTROL_3_VRH_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_3, data); */
-  DMDIF_writeReg(DMD_SSD2119_POWER_CONTROL_3, data);
-
-  data  = DMD_SSD2119_POWER_CONTROL_4_VCOMG;
-  data |= 0x0D << DMD_SSD2119_POWER_CONTROL_4_VDV_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_4, data); */
-  DMDIF_writeReg(DMD_SSD2119_POWER_CONTROL_4, data);
-
-  data  = DMD_SSD2119_POWER_CONTROL_5_NOTP;
-  data |= 0x3E << DMD_SSD2119_POWER_CONTROL_5_VCM_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_5, data); */
-  DMDIF_writeReg(DMD_SSD2119_POWER_CONTROL_5, data);
-
-  data = 0x0058;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GENERIC_INTERFACE_CONTROL, data); */
-  DMDIF_writeReg(DMD_SSD2119_GENERIC_INTERFACE_CONTROL, data);
-
-  /* Gamma settings */
-  data  = 0x00 << DMD_SSD2119_GAMMA_1_PKP1_SHIFT;
-  data |= 0x00 << DMD_SSD2119_GAMMA_1_PKP0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_1, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_1, data);
-
-  data  = 0x01 << DMD_SSD2119_GAMMA_2_PKP3_SHIFT;
-  data |= 0x01 << DMD_SSD2119_GAMMA_2_PKP2_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_2, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_2, data);
-
-  data  = 0x01 << DMD_SSD2119_GAMMA_3_PKP5_SHIFT;
-  data |= 0x00 << DMD_SSD2119_GAMMA_3_PKP4_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_3, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_3, data);
-
-  data  = 0x03 << DMD_SSD2119_GAMMA_4_PRP1_SHIFT;
-  data |= 0x05 << DMD_SSD2119_GAMMA_4_PRP0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_4, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_4, data);
-
-  data  = 0x07 << DMD_SSD2119_GAMMA_5_PKN1_SHIFT;
-  data |= 0x07 << DMD_SSD2119_GAMMA_5_PKN0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_5, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_5, data);
-
-  data  = 0x03 << DMD_SSD2119_GAMMA_6_PKN3_SHIFT;
-  data |= 0x05 << DMD_SSD2119_GAMMA_6_PKN2_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_6, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_6, data);
-
-  data  = 0x07 << DMD_SSD2119_GAMMA_7_PKN5_SHIFT;
-  data |= 0x07 << DMD_SSD2119_GAMMA_7_PKN4_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_7, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_7, data);
-
-  data  = 0x02 << DMD_SSD2119_GAMMA_8_PRN1_SHIFT;
-  data |= 0x01 << DMD_SSD2119_GAMMA_8_PRN0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_8, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_8, data);
-
-  data  = 0x12 << DMD_SSD2119_GAMMA_9_VRP1_SHIFT;
-  data |= 0x00 << DMD_SSD2119_GAMMA_9_VRP0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_9, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_9, data);
-
-  data  = 0x09 << DMD_SSD2119_GAMMA_10_VRN1_SHIFT;
-  data |= 0x00 << DMD_SSD2119_GAMMA_10_VRN0_SHIFT;
-  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_10, data); */
-  DMDIF_writeReg(DMD_SSD2119_GAMMA_10, data);
-
-  /* Set up dimensions of the display */
-  dimensions.xSize = DMD_HORIZONTAL_SIZE;
-  dimensions.ySize = DMD_VERTICAL_SIZE;
-
-  /* At initialization, the clip is the entire display */
-  dimensions.xClipStart = 0;
-  dimensions.yClipStart = 0;
-  dimensions.clipWidth  = dimensions.xSize;
-  dimensions.clipHeight = dimensions.ySize;
-
-  initialized = 1;
-
-  /* Fill the entire display with black color */
-  DMD_writeColor(0, 0, 0x00, 0x00, 0x00, dimensions.xSize * dimensions.ySize);
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  \brief
-*  Get the dimensions of the display and of the current clipping area
-*
-*  \return
-*  DMD_Dimensions structure containing the size of the display and the
-*  clipping area
-******************************************************************************/
-EMSTATUS DMD_getDisplayGeometry(DMD_DisplayGeometry **geometry)
-{
-  if (!initialized)
-  {
-    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-  }
-  *geometry = &dimensions;
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Sets the clipping area. All coordinates given to writeData/writeColor/readData
-*  are relative to this clipping area.
-*
-*  @param xStart
-*  X coordinate of the upper left corner of the clipping area
-*  @param yStart
-*  Y coordinate of the upper left corner of the clipping area
-*  @param width
-*  Width of the clipping area
-*  @param height
-*  Height of the clipping area
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_setClippingArea(uint16_t xStart, uint16_t yStart,
-                             uint16_t width, uint16_t height)
-{
-  uint16_t verticalPos;
-  uint16_t xEnd;
-  uint16_t yEnd;
-
-  if (!initialized)
-  {
-    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-  }
-
-  /* Check parameters */
-  if (xStart + width > dimensions.xSize ||
-      yStart + height > dimensions.ySize)
-  {
-    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
-  }
-
-  if (width == 0 || height == 0)
-  {
-    return DMD_ERROR_EMPTY_CLIPPING_AREA;
-  }
-
-  xEnd = xStart + width - 1;
-  yEnd = yStart + height - 1;
-
-  /* Set the clipping region in the display */
-  DMDIF_writeReg(DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS, xStart);
-  DMDIF_writeReg(DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS, xEnd);
-
-  verticalPos  = yEnd << DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT;
-  verticalPos |= yStart << DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_START_SHIFT;
-  DMDIF_writeReg(DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS, verticalPos);
-
-  /* Update the dimensions structure */
-  dimensions.xClipStart = xStart;
-  dimensions.yClipStart = yStart;
-  dimensions.clipWidth  = width;
-  dimensions.clipHeight = height;
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Set the x and y coordinate of the next pixel to draw
-*
-*  @param x
-*  X address of the pixel, relative to the current clipping area
-*  @param y
-*  Y address of the pixel, relative to the current clipping area
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS setPixelAddress(uint16_t x, uint16_t y)
-{
-  /* Check parameters */
-  if (x > dimensions.clipWidth || y > dimensions.clipHeight)
-  {
-    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
-  }
-
-  /* Set pixel position */
-  DMDIF_writeReg(DMD_SSD2119_SET_X_ADDRESS_COUNTER,
-                 x + dimensions.xClipStart);
-  DMDIF_writeReg(DMD_SSD2119_SET_Y_ADDRESS_COUNTER,
-                 y + dimensions.yClipStart);
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws pixels to the display
-*
-*  @param x
-*  X coordinate of the first pixel to be written, relative to the clipping area
-*  @param y
-*  Y coordinate of the first pixel to be written, relative to the clipping area
-*  @param data
-*  Array containing the pixel data. Each 8-bit element in the array are one color
-*  component of the pixel, so that 3 bytes represent one pixel. The pixels are
-*  ordered by increasing x coordinate, after the last pixel of a row, the next
-*  pixel will be the first pixel on the next row.
-*  @param numPixels
-*  Number of pixels to be written
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
-                       uint32_t numPixels)
-{
-  uint32_t statusCode;
-  uint32_t clipRemaining;
-  uint32_t color;
-  uint32_t i;
-
-  if (!initialized)
-  {
-    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-  }
-
-  /* Set the address of the first pixel */
-  statusCode = setPixelAddress(x, y);
-  if (statusCode != DMD_OK)
-  {
-    return statusCode;
-  }
-
-  /* Number of pixels from the first pixel (given by x and y) to the end
-   * of the clipping area */
-  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
-                  dimensions.clipWidth - x;
-
-  /* Check that the length of data isn't longer than the number of pixels
-   * in the rest of the clipping area */
-  if (numPixels > clipRemaining)
-  {
-    return DMD_ERROR_TOO_MUCH_DATA;
-  }
-
-  /* Write data */
-  DMDIF_prepareDataAccess( );
-  for (i = 0; i < numPixels; i++)
-  {
-    color = colorTransform24To16bpp(data[3 * i], data[3 * i + 1],
-                                    data[3 * i + 2]);
-    DMDIF_writeData(color);
-  }
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws pixels to the display at location x,y, from a source data array in
-*  GIMP RLE compressed C-format, mixing with another RGB color to create a
-*  "blended" look or for fading images in and out
-*  @param x
-*  X coordinate of the first pixel to be written, relative to the clipping area
-*  @param y
-*  Y coordinate of the first pixel to be written, relative to the clipping area
-*  @param data
-*  Array containing the pixel data in GIMP RLE compressed format
-*  @param numPixels
-*  Number of pixels to be written
-*  @param red
-*  Red component of color to mix with orignal
-*  @param green
-*  Red component of color to mix with orignal
-*  @param blue
-*  Red component of color to mix with orignal
-*  @param weight
-*  Ratio to which red/green/blue component and original color should be combined
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_writeDataRLEFade(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
-			      const uint8_t *data,
-			      int red, int green, int blue, int weight)
-{
-   uint32_t color = 0;
-   int xpos, ypos;
-   const uint8_t *ptr;
-   int r,g,b;
-   uint8_t readRGB = 0;
-   uint8_t copyColor = 0;
-
-
-   ptr = data;
-   for (ypos = y; ypos < (ylen+y); ypos++){
-
-      setPixelAddress(x, ypos);
-      DMDIF_prepareDataAccess( );
-
-      for (xpos = x; xpos < (xlen+x); xpos++){
-
-         if ( readRGB ) {
-            readRGB--;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            r = ((r * weight/100) + (red * (100-weight)/100));
-            g = ((g * weight/100) + (green * (100-weight)/100));
-            b = ((b * weight/100) + (blue * (100-weight)/100));
-            color = colorTransform24To16bpp(r,g,b);
-            DMDIF_writeData(color);
-            continue;
-         }
-         if ( copyColor ) {
-            copyColor--;
-            DMDIF_writeData( color );
-            continue;
-         }
-         if ( *ptr & 0x80 ) {
-            copyColor = (*ptr - 0x80);
-            ptr++;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            r = ((r * weight/100) + (red * (100-weight)/100));
-            g = ((g * weight/100) + (green * (100-weight)/100));
-            b = ((b * weight/100) + (blue * (100-weight)/100));
-            copyColor--;
-         }
-         else {
-            readRGB = *ptr;
-            ptr++;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            r = ((r * weight/100) + (red * (100-weight)/100));
-            g = ((g * weight/100) + (green * (100-weight)/100));
-            b = ((b * weight/100) + (blue * (100-weight)/100));
-            readRGB--;
-         }
-
-         color = colorTransform24To16bpp(r,g,b);
-         DMDIF_writeData( color );
-
-      }
-
-   }
-
-   return DMD_OK;
-
-}
-
-
-/**************************************************************************//**
-*  @brief
-*  Draws pixels to the display at location x,y, from a source data array in
-*  GIMP RLE compressed C-format
-*  @param x
-*  X coordinate of the first pixel to be written, relative to the clipping area
-*  @param y
-*  Y coordinate of the first pixel to be written, relative to the clipping area
-*  @param data
-*  Array containing the pixel data in GIMP RLE compressed format
-*  @param numPixels
-*  Number of pixels to be written
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_writeDataRLE(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
-                          const uint8_t *data)
-{
-   uint32_t color = 0;
-   int xpos, ypos;
-   const uint8_t *ptr;
-   uint8_t r,g,b;
-   uint8_t readRGB = 0;
-   uint8_t copyColor = 0;
-
-   ptr = data;
-   for (ypos = y; ypos < (ylen+y); ypos++){
-
-      setPixelAddress(x, ypos);
-      DMDIF_prepareDataAccess( );
-      for (xpos = x; xpos < (xlen+x); xpos++){
-
-         if ( readRGB ) {
-            readRGB--;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            color = colorTransform24To16bpp(r,g,b);
-            DMDIF_writeData(color);
-            continue;
-         }
-         if ( copyColor ) {
-            copyColor--;
-            DMDIF_writeData( color );
-            continue;
-         }
-
-         if ( *ptr & 0x80 ) {
-            copyColor = (*ptr - 0x80);
-            ptr++;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            copyColor--;
-         } else {
-            readRGB = *ptr;
-            ptr++;
-            r = *ptr++;
-            g = *ptr++;
-            b = *ptr++;
-            readRGB--;
-         }
-
-         color = colorTransform24To16bpp(r,g,b);
-         DMDIF_writeData( color );
-
-      }
-
-   }
-
-   return DMD_OK;
-
-}
-
-/**************************************************************************//**
-*  @brief
-*  Reads data from display memory
-*  DOESN'T WORK yet - TIMING ISSUE?
-*
-*  @param x
-*  X coordinate of the first pixel to be read, relative to the clipping area
-*  @param y
-*  Y coordinate of the first pixel to be read, relative to the clipping area
-*  @param data
-*  Pointer to where the pixel data will be stored
-*  @param numPixels
-*  Number of pixels to be read
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_readData(uint16_t x, uint16_t y,
-                      uint8_t data[], uint32_t numPixels)
-{
-  uint32_t statusCode;
-  uint32_t clipRemaining;
-  uint32_t i;
-  uint32_t color;
-  uint8_t  red, green, blue;
-
-  if (!initialized)
-  {
-    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-  }
-
-  /* Set the address of the first pixel */
-  statusCode = setPixelAddress(x, y);
-  if (statusCode != DMD_OK)
-  {
-    return statusCode;
-  }
-
-  /* Number of pixels from the first pixel (given by x and y) to the end
-   * of the clipping area */
-  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
-                  dimensions.clipWidth - x;
-  /* Check that the length of data isn't longer than the number of pixels
-   * in the rest of the clipping area */
-  if (numPixels > clipRemaining)
-  {
-    return DMD_ERROR_TOO_MUCH_DATA;
-  }
-
-  /* Read data */
-  DMDIF_prepareDataAccess();
-  for (i = 0; i < numPixels; i++)
-  {
-    /* Dummy read  */
-    color = DMDIF_readData();
-    /* Read the color value */
-    color = DMDIF_readData();
-
-    /* Transform into 24bpp */
-    colorTransform16To24bpp(color, &red, &green, &blue);
-
-    data[3 * i]     = red;
-    data[3 * i + 1] = green;
-    data[3 * i + 2] = blue;
-
-    /* Update the position. This is not done automatically for reading, so
-     * it must be set for every read. */
-    x++;
-    if (x > dimensions.clipWidth)
-    {
-      y++;
-      x = 0;
-      if (y > dimensions.clipHeight)
-      {
-        y = 0;
-      }
-    }
-
-    statusCode = setPixelAddress(x, y);
-    if (statusCode != DMD_OK)
-    {
-      return statusCode;
-    }
-  }
-
-  return DMD_OK;
-}
-
-/**************************************************************************//**
-*  \brief
-*  Draws a number of pixels of the same color to the display
-*
-*  @param x
-*  X coordinate of the first pixel to be written, relative to the clipping area
-*  @param y
-*  Y coordinate of the first pixel to be written, relative to the clipping area
-*  @param red
-*  Red component of the color
-*  @param green
-*  Green component of the color
-*  @param blue
-*  Blue component of the color
-*  @param numPixels
-*  Number of pixels to be written
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
-                        uint8_t green, uint8_t blue, uint32_t numPixels)
-{
-
-   uint32_t clipRemaining;
-   uint32_t statusCode;
-   uint32_t color;
-
-   if (!initialized){
-      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-   }
-
-   /* Set the address of the first pixel */
-   statusCode = setPixelAddress(x, y);
-   if (statusCode != DMD_OK){
-      return statusCode;
-   }
-
-   /* Number of pixels from the first pixel (given by x and y) to the end
-    * of the clipping area */
-   clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
-      dimensions.clipWidth - x;
-
-   /* Check that the length of data isn't longer than the number of pixels
-    * in the rest of the clipping area */
-   if (numPixels > clipRemaining){
-      return DMD_ERROR_TOO_MUCH_DATA;
-   }
-
-   /* Write data */
-   DMDIF_prepareDataAccess( );
-   color = colorTransform24To16bpp(red, green, blue);
-
-   DMDIF_writeDataRepeated(color, numPixels);
-
-   return DMD_OK;
-
-}
-
-/**************************************************************************//**
-*  @brief
-*  Turns off the display and puts it into sleep mode
-*  Does not turn off backlight
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_sleep(void){
-
-   uint16_t data;
-
-   if (!initialized){
-      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-   }
-
-   /* Put into sleep mode */
-   data = DMD_SSD2119_SLEEP_MODE_1_SLP;
-   DMDIF_writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
-
-   /* Turn off display */
-   data = 0;
-   DMDIF_writeReg(DMD_SSD2119_DISPLAY_CONTROL, 0x0000);
-
-   /* Delay 1.5 frame */
-   /*DMDIF_delay((1000 / DMD_FRAME_FREQUENCY) * 3 / 2);*/
-
-   return DMD_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Wakes up the display from sleep mode
-*
-*  @return
-*  DMD_OK on success, otherwise error code
-******************************************************************************/
-EMSTATUS DMD_wakeUp(void){
-
-   uint16_t data;
-
-   if (!initialized){
-      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
-   }
-
-   /* Get out of sleep mode */
-   data = 0;
-   DMDIF_writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
-
-   /* Turn on display */
-   data  = DMD_SSD2119_DISPLAY_CONTROL_DTE;
-   data |= DMD_SSD2119_DISPLAY_CONTROL_GON;
-   data |= DMD_SSD2119_DISPLAY_CONTROL_D1;
-   data |= DMD_SSD2119_DISPLAY_CONTROL_D0;
-   DMDIF_writeReg(DMD_SSD2119_DISPLAY_CONTROL, 0x0033);
-
-   /* Delay 10 frames */
-   /*DMDIF_delay((1000 / DMD_FRAME_FREQUENCY) * 10);*/
-
-   return DMD_OK;
-
-}
-
-/**************************************************************************//**
-*  @brief
-*  Transforms a 24bpp pixel data into an 16bpp pixel
-*
-*  @param red
-*  8-bit red component of the pixel
-*  @param green
-*  8-bit green component of the pixel
-*  @param blue
-*  8-bit blue component of the pixel
-*  @return
-*  16bpp value of pixel
-******************************************************************************/
-static uint32_t colorTransform24To16bpp(uint8_t red, uint8_t green, uint8_t blue){
-
-   /* Transform each color into 6 bits by dropping the 2 LSB */
-   red   = (red >> 3) & 0x1F;
-   green = (green >> 2) & 0x3F;
-   blue  = (blue >> 3) & 0x1F;
-
-   /* Put it together to one 16bpp color number */
-   return (red << 11) | (green << 5) | blue;
-
-}
-
-/**************************************************************************//**
-*  @brief
-*  Transforms an 18 bpp pixel into a 24bpp pixel
-*
-*  @param color
-*  16bpp color pixel
-*  @param red
-*  return value for red component of 24bpp pixel
-*  @param green
-*  return value for green component of 24bpp pixel
-*  @param blue
-*  return value for blue component of 24bpp pixel
-******************************************************************************/
-static void colorTransform16To24bpp(uint32_t color, uint8_t *red,
-                                    uint8_t *green, uint8_t *blue){
-
-  /* Get the individual colors out of the 16bpp number */
-  uint8_t redValue   = (color & 0x0000F800) >> 11;
-  uint8_t greenValue = (color & 0x000007E0) >> 5;
-  uint8_t blueValue  = (color & 0x0000001F);
-
-  /* Convert each color to 8-bit */
-  redValue   <<= 3;
-  greenValue <<= 2;
-  blueValue  <<= 3;
-
-  *red   = redValue;
-  *green = greenValue;
-  *blue  = blueValue;
-
-  return;
-
-}
-
-
-/**************************************************************************//**
-*  @brief
-*  Set horizontal and vertical flip mode of display controller
-*
-*  @param hor
-*  Set to flip display horizontally
-*
-*  @param ver
-*  Set to flip display vertically
-*
-*  @return
-*  Returns DMD_OK is successful, error otherwise.
-******************************************************************************/
-EMSTATUS DMD_flipDisplay(int horizontal, int vertical){
-
-  uint16_t reg;
-
-  reg = rcDriverOutputControl;
-
-  if (horizontal) reg &= ~DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
-  else reg |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
-
-  if (vertical) reg &= ~DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
-  else reg |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
-
-  rcDriverOutputControl = reg;
-  DMDIF_writeReg(DMD_SSD2119_DRIVER_OUTPUT_CONTROL, rcDriverOutputControl);
-
-  return DMD_OK;
-
-}
+ /*************************************************************************//**
+ * @file dmd_ssd2119.c
+ * @brief Dot matrix display driver for LCD controller SSD2119
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "dmd_ssd2119.h"
+#include "dmd_ssd2119_registers.h"
+#include "dmdif_ssd2119_ebi.h"
+
+/** Dimensions of the display */
+DMD_DisplayGeometry dimensions;
+
+/* Local variables */
+static uint32_t initialized = 0;
+static uint16_t rcDriverOutputControl;
+
+/* Shadow copy of the controller registers, see writeReg() */
+#define DMD_REGISTER_CACHE_SIZE    (DMD_SSD2119_SET_Y_ADDRESS_COUNTER + 1)
+static uint16_t rcRegisters[DMD_REGISTER_CACHE_SIZE];
+static uint8_t  rcValid[DMD_REGISTER_CACHE_SIZE];
+
+/* Where the GRAM address counter will be after the last write burst, and
+ * whether the index register still selects the GRAM for writing */
+static uint32_t cursorValid;
+static uint16_t cursorX;
+static uint16_t cursorY;
+static uint32_t gramSelected;
+
+/* Transaction counters kept by the driver, see DMD_getStats() */
+static uint32_t statAddressSetups = 0;
+static uint32_t statWindowSetups  = 0;
+
+/* Local function prototypes */
+static uint32_t colorTransform24To16bpp( uint8_t red, uint8_t green, uint8_t blue);
+static void colorTransform16To24bpp(uint32_t color,
+                                    uint8_t *red, uint8_t *green, uint8_t *blue);
+static EMSTATUS setPixelAddress(uint16_t x, uint16_t y, uint32_t numPixels);
+static EMSTATUS writeReg(uint8_t reg, uint16_t data);
+static void setWindow(uint16_t x, uint16_t y, uint32_t numPixels);
+static void advanceCursor(uint32_t numPixels);
+static void prepareDataWrite(void);
+static void prepareDataRead(void);
+/**************************************************************************//**
+*  @brief
+*  Initializes the LCD display
+*
+*  @param cmdRegAddr
+*  The address in memory where data to the command register in the display
+*  controller are written
+*  @param dataRegAddr
+*  The address in memory where data to the data register in the display
+*  controller are written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_init(uint32_t cmdRegAddr, uint32_t dataRegAddr){
+
+  EMSTATUS stat;
+  uint16_t data;
+
+  /* Initialize register cache variables */
+  rcDriverOutputControl = 0;
+  memset(rcValid, 0, sizeof(rcValid));
+  cursorValid  = 0;
+  gramSelected = 0;
+
+  /* Initialize DMD interface */
+  if ((stat = DMDIF_init(cmdRegAddr, dataRegAddr)) != DMD_OK)
+  {
+    return stat;
+  }
+
+  /* Initialization sequence, see UMSH-8252MD-T page 13 */
+
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_VCOM_OTP_1, 0x0006); */
+  writeReg(DMD_SSD2119_VCOM_OTP_1, 0x0006);
+
+  /* Start oscillation */
+  data = DMD_SSD2119_OSCILLATION_START_OSCEN;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_OSCILLATION_START, data); */
+  writeReg(DMD_SSD2119_OSCILLATION_START, data);
+
+  /* Exit sleep mode */
+  data = 0;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_SLEEP_MODE_1, data); */
+  writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
+
+  /* Display control */
+  data  = DMD_SSD2119_DISPLAY_CONTROL_DTE;
+  data |= DMD_SSD2119_DISPLAY_CONTROL_GON;
+  data |= DMD_SSD2119_DISPLAY_CONTROL_D1;
+  data |= DMD_SSD2119_DISPLAY_CONTROL_D0;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_DISPLAY_CONTROL, data); */
+  writeReg(DMD_SSD2119_DISPLAY_CONTROL, data);
+
+  /* Entry mode */
+  data  = DMD_SSD2119_ENTRY_MODE_DFM_65K << DMD_SSD2119_ENTRY_MODE_DFM_SHIFT;
+  data |= DMD_SSD2119_ENTRY_MODE_DENMODE;
+  data |= DMD_SSD2119_ENTRY_MODE_WMODE;
+  data |= DMD_SSD2119_ENTRY_MODE_NOSYNC;
+  data |= DMD_SSD2119_ENTRY_MODE_TY_TYPE_B << DMD_SSD2119_ENTRY_MODE_TY_SHIFT;
+  data |= DMD_SSD2119_ENTRY_MODE_ID1;
+  data |= DMD_SSD2119_ENTRY_MODE_ID0;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_ENTRY_MODE, data); */
+  writeReg(DMD_SSD2119_ENTRY_MODE, data);
+
+  /* LCD AC control */
+  data  = DMD_SSD2119_LCD_AC_CONTROL_BC;
+  data |= DMD_SSD2119_LCD_AC_CONTROL_EOR;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_LCD_AC_CONTROL, data); */
+  writeReg(DMD_SSD2119_LCD_AC_CONTROL, data);
+
+  /* Power control */
+  data  = 0x06 << DMD_SSD2119_POWER_CONTROL_1_DCT_SHIFT;
+  data |= 0x05 << DMD_SSD2119_POWER_CONTROL_1_BT_SHIFT;
+  data |= 0x03 << DMD_SSD2119_POWER_CONTROL_1_DC_SHIFT;
+  data |= 0x04 << DMD_SSD2119_POWER_CONTROL_1_AP_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_1, data); */
+  writeReg(DMD_SSD2119_POWER_CONTROL_1, data);
+
+  /* Driver output control */
+  data                  = DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
+  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_REV;
+  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_GD;
+  data                 |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
+  data                 |= (DMD_VERTICAL_SIZE - 1) << DMD_SSD2119_DRIVER_OUTPUT_CONTROL_MUX_SHIFT;
+  rcDriverOutputControl = data;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_DRIVER_OUTPUT_CONTROL, data); */
+  writeReg(DMD_SSD2119_DRIVER_OUTPUT_CONTROL, data);
+
+  /* Power Control */
+  data = 0x05 << DMD_SSD2119_POWER_CONTROL_2_VRC_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_2, data); */
+  writeReg(DMD_SSD2119_POWER_CONTROL_2, data);
+
+  data = 0x0D << DMD_SSD2119_POWER_CONTROL_3_VRH_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_3, data); */
+  writeReg(DMD_SSD2119_POWER_CONTROL_3, data);
+
+  data  = DMD_SSD2119_POWER_CONTROL_4_VCOMG;
+  data |= 0x0D << DMD_SSD2119_POWER_CONTROL_4_VDV_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_4, data); */
+  writeReg(DMD_SSD2119_POWER_CONTROL_4, data);
+
+  data  = DMD_SSD2119_POWER_CONTROL_5_NOTP;
+  data |= 0x3E << DMD_SSD2119_POWER_CONTROL_5_VCM_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_POWER_CONTROL_5, data); */
+  writeReg(DMD_SSD2119_POWER_CONTROL_5, data);
+
+  data = 0x0058;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GENERIC_INTERFACE_CONTROL, data); */
+  writeReg(DMD_SSD2119_GENERIC_INTERFACE_CONTROL, data);
+
+  /* Gamma settings */
+  data  = 0x00 << DMD_SSD2119_GAMMA_1_PKP1_SHIFT;
+  data |= 0x00 << DMD_SSD2119_GAMMA_1_PKP0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_1, data); */
+  writeReg(DMD_SSD2119_GAMMA_1, data);
+
+  data  = 0x01 << DMD_SSD2119_GAMMA_2_PKP3_SHIFT;
+  data |= 0x01 << DMD_SSD2119_GAMMA_2_PKP2_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_2, data); */
+  writeReg(DMD_SSD2119_GAMMA_2, data);
+
+  data  = 0x01 << DMD_SSD2119_GAMMA_3_PKP5_SHIFT;
+  data |= 0x00 << DMD_SSD2119_GAMMA_3_PKP4_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_3, data); */
+  writeReg(DMD_SSD2119_GAMMA_3, data);
+
+  data  = 0x03 << DMD_SSD2119_GAMMA_4_PRP1_SHIFT;
+  data |= 0x05 << DMD_SSD2119_GAMMA_4_PRP0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_4, data); */
+  writeReg(DMD_SSD2119_GAMMA_4, data);
+
+  data  = 0x07 << DMD_SSD2119_GAMMA_5_PKN1_SHIFT;
+  data |= 0x07 << DMD_SSD2119_GAMMA_5_PKN0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_5, data); */
+  writeReg(DMD_SSD2119_GAMMA_5, data);
+
+  data  = 0x03 << DMD_SSD2119_GAMMA_6_PKN3_SHIFT;
+  data |= 0x05 << DMD_SSD2119_GAMMA_6_PKN2_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_6, data); */
+  writeReg(DMD_SSD2119_GAMMA_6, data);
+
+  data  = 0x07 << DMD_SSD2119_GAMMA_7_PKN5_SHIFT;
+  data |= 0x07 << DMD_SSD2119_GAMMA_7_PKN4_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_7, data); */
+  writeReg(DMD_SSD2119_GAMMA_7, data);
+
+  data  = 0x02 << DMD_SSD2119_GAMMA_8_PRN1_SHIFT;
+  data |= 0x01 << DMD_SSD2119_GAMMA_8_PRN0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_8, data); */
+  writeReg(DMD_SSD2119_GAMMA_8, data);
+
+  data  = 0x12 << DMD_SSD2119_GAMMA_9_VRP1_SHIFT;
+  data |= 0x00 << DMD_SSD2119_GAMMA_9_VRP0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_9, data); */
+  writeReg(DMD_SSD2119_GAMMA_9, data);
+
+  data  = 0x09 << DMD_SSD2119_GAMMA_10_VRN1_SHIFT;
+  data |= 0x00 << DMD_SSD2119_GAMMA_10_VRN0_SHIFT;
+  /*  printf("R%x: 0x%x\n", DMD_SSD2119_GAMMA_10, data); */
+  writeReg(DMD_SSD2119_GAMMA_10, data);
+
+  /* Set up dimensions of the display */
+  dimensions.xSize = DMD_HORIZONTAL_SIZE;
+  dimensions.ySize = DMD_VERTICAL_SIZE;
+
+  /* At initialization, the clip is the entire display */
+  dimensions.xClipStart = 0;
+  dimensions.yClipStart = 0;
+  dimensions.clipWidth  = dimensions.xSize;
+  dimensions.clipHeight = dimensions.ySize;
+
+  initialized = 1;
+
+  /* Fill the entire display with black color */
+  DMD_writeColor(0, 0, 0x00, 0x00, 0x00, dimensions.xSize * dimensions.ySize);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  \brief
+*  Get the dimensions of the display and of the current clipping area
+*
+*  \return
+*  DMD_Dimensions structure containing the size of the display and the
+*  clipping area
+******************************************************************************/
+EMSTATUS DMD_getDisplayGeometry(DMD_DisplayGeometry **geometry)
+{
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+  *geometry = &dimensions;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the clipping area. All coordinates given to writeData/writeColor/readData
+*  are relative to this clipping area.
+*
+*  The window registers in the controller are not written until pixel data
+*  is transferred, and only if the transfer does not fit in the window that
+*  is already set up.
+*
+*  @param xStart
+*  X coordinate of the upper left corner of the clipping area
+*  @param yStart
+*  Y coordinate of the upper left corner of the clipping area
+*  @param width
+*  Width of the clipping area
+*  @param height
+*  Height of the clipping area
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_setClippingArea(uint16_t xStart, uint16_t yStart,
+                             uint16_t width, uint16_t height)
+{
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  /* Check parameters */
+  if (xStart + width > dimensions.xSize ||
+      yStart + height > dimensions.ySize)
+  {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+
+  if (width == 0 || height == 0)
+  {
+    return DMD_ERROR_EMPTY_CLIPPING_AREA;
+  }
+
+  /* Update the dimensions structure */
+  dimensions.xClipStart = xStart;
+  dimensions.yClipStart = yStart;
+  dimensions.clipWidth  = width;
+  dimensions.clipHeight = height;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Set the x and y coordinate of the next pixel to draw
+*
+*  @param x
+*  X address of the pixel, relative to the current clipping area
+*  @param y
+*  Y address of the pixel, relative to the current clipping area
+*  @param numPixels
+*  Number of pixels that will be transferred from this position
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+static EMSTATUS setPixelAddress(uint16_t x, uint16_t y, uint32_t numPixels)
+{
+  uint16_t xPixel;
+  uint16_t yPixel;
+
+  /* Check parameters */
+  if (x > dimensions.clipWidth || y > dimensions.clipHeight)
+  {
+    return DMD_ERROR_PIXEL_OUT_OF_BOUNDS;
+  }
+
+  /* Make sure the window in the controller covers the transfer */
+  setWindow(x, y, numPixels);
+
+  xPixel = x + dimensions.xClipStart;
+  yPixel = y + dimensions.yClipStart;
+
+  /* Nothing to do if the previous burst left the address counter here */
+  if (cursorValid && cursorX == xPixel && cursorY == yPixel)
+  {
+    return DMD_OK;
+  }
+
+  /* Set pixel position */
+  statAddressSetups++;
+  writeReg(DMD_SSD2119_SET_X_ADDRESS_COUNTER, xPixel);
+  writeReg(DMD_SSD2119_SET_Y_ADDRESS_COUNTER, yPixel);
+
+  cursorValid = 1;
+  cursorX     = xPixel;
+  cursorY     = yPixel;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Make sure the window in the controller covers a pixel transfer
+*
+*  A transfer that ends before the right edge of the clipping area never
+*  makes the address counter wrap, so any window that contains the row
+*  segment will do. Other transfers need the window to match the clipping
+*  area exactly, so that the next transfer can continue on the next row.
+*  The window registers are only written when the window has to change.
+*
+*  @param x
+*  X address of the first pixel, relative to the current clipping area
+*  @param y
+*  Y address of the first pixel, relative to the current clipping area
+*  @param numPixels
+*  Number of pixels in the transfer
+******************************************************************************/
+static void setWindow(uint16_t x, uint16_t y, uint32_t numPixels)
+{
+  uint16_t xStart, xEnd;
+  uint16_t yStart, yEnd;
+  uint16_t verticalPos;
+  uint16_t xPixel = dimensions.xClipStart + x;
+  uint16_t yPixel = dimensions.yClipStart + y;
+  uint32_t windowValid = rcValid[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS] &&
+                         rcValid[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS] &&
+                         rcValid[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS];
+
+  if (numPixels == 0)
+  {
+    numPixels = 1;
+  }
+
+  if (x + numPixels < dimensions.clipWidth ||
+      (x + numPixels == dimensions.clipWidth && y + 1 == dimensions.clipHeight))
+  {
+    /* Keep the current window if it contains the row segment */
+    verticalPos = rcRegisters[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS];
+    if (windowValid &&
+        xPixel >= rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS] &&
+        xPixel + numPixels - 1 <=
+        rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS] &&
+        yPixel >= (verticalPos & 0xFF) &&
+        yPixel <= (verticalPos >> DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT))
+    {
+      return;
+    }
+
+    /* Otherwise open the window to the whole display, which will also
+     * contain the row segments of the following transfers */
+    xStart = 0;
+    xEnd   = dimensions.xSize - 1;
+    yStart = 0;
+    yEnd   = dimensions.ySize - 1;
+  }
+  else
+  {
+    xStart = dimensions.xClipStart;
+    xEnd   = dimensions.xClipStart + dimensions.clipWidth - 1;
+    yStart = dimensions.yClipStart;
+    yEnd   = dimensions.yClipStart + dimensions.clipHeight - 1;
+  }
+
+  verticalPos  = yEnd << DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT;
+  verticalPos |= yStart << DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_START_SHIFT;
+
+  if (windowValid &&
+      rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS] == xStart &&
+      rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS] == xEnd &&
+      rcRegisters[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS] == verticalPos)
+  {
+    return;
+  }
+
+  /* Set the clipping region in the display. The address counter is not
+   * trusted to survive a window change. */
+  statWindowSetups++;
+  cursorValid = 0;
+  writeReg(DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS, xStart);
+  writeReg(DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS, xEnd);
+  writeReg(DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS, verticalPos);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Write a controller register, unless the shadow copy shows that it already
+*  holds the value. The address counter, the GRAM port and the oscillator
+*  register are always written.
+*
+*  @param reg
+*  Register to write to
+*  @param data
+*  16-bit data to write into register
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+static EMSTATUS writeReg(uint8_t reg, uint16_t data)
+{
+  if (reg < DMD_REGISTER_CACHE_SIZE &&
+      reg != DMD_SSD2119_OSCILLATION_START &&
+      reg != DMD_SSD2119_ACCESS_DATA &&
+      reg != DMD_SSD2119_SET_X_ADDRESS_COUNTER &&
+      reg != DMD_SSD2119_SET_Y_ADDRESS_COUNTER)
+  {
+    if (rcValid[reg] && rcRegisters[reg] == data)
+    {
+      return DMD_OK;
+    }
+    rcRegisters[reg] = data;
+    rcValid[reg]     = 1;
+  }
+
+  gramSelected = 0;
+  return DMDIF_writeReg(reg, data);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Move the tracked address counter past a write burst, wrapping inside the
+*  window the same way the controller does
+*
+*  @param numPixels
+*  Number of pixels written
+******************************************************************************/
+static void advanceCursor(uint32_t numPixels)
+{
+  uint16_t xStart, xEnd, yStart, yEnd;
+  uint32_t pos;
+
+  if (!cursorValid)
+  {
+    return;
+  }
+
+  xStart = rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS];
+  xEnd   = rcRegisters[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS];
+  yStart = rcRegisters[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS] & 0xFF;
+  yEnd   = rcRegisters[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS]
+           >> DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT;
+
+  pos     = (cursorX - xStart) + numPixels;
+  cursorX = xStart + pos % (xEnd - xStart + 1);
+  pos     = (cursorY - yStart) + pos / (xEnd - xStart + 1);
+  cursorY = yStart + pos % (yEnd - yStart + 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Select the GRAM for writing, unless it is still selected from the
+*  previous write burst
+******************************************************************************/
+static void prepareDataWrite(void)
+{
+  if (!gramSelected)
+  {
+    DMDIF_prepareDataAccess();
+    gramSelected = 1;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Select the GRAM for reading. Reads leave neither the address counter nor
+*  the GRAM selection usable for the next write burst.
+******************************************************************************/
+static void prepareDataRead(void)
+{
+  cursorValid  = 0;
+  gramSelected = 0;
+  DMDIF_prepareDataAccess();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws pixels to the display
+*
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param data
+*  Array containing the pixel data. Each 8-bit element in the array are one color
+*  component of the pixel, so that 3 bytes represent one pixel. The pixels are
+*  ordered by increasing x coordinate, after the last pixel of a row, the next
+*  pixel will be the first pixel on the next row.
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeData(uint16_t x, uint16_t y, const uint8_t data[],
+                       uint32_t numPixels)
+{
+  uint32_t statusCode;
+  uint32_t clipRemaining;
+  uint32_t color;
+  uint32_t i;
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  /* Set the address of the first pixel */
+  statusCode = setPixelAddress(x, y, numPixels);
+  if (statusCode != DMD_OK)
+  {
+    return statusCode;
+  }
+
+  /* Number of pixels from the first pixel (given by x and y) to the end
+   * of the clipping area */
+  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
+                  dimensions.clipWidth - x;
+
+  /* Check that the length of data isn't longer than the number of pixels
+   * in the rest of the clipping area */
+  if (numPixels > clipRemaining)
+  {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+
+  /* Write data */
+  prepareDataWrite();
+  for (i = 0; i < numPixels; i++)
+  {
+    color = colorTransform24To16bpp(data[3 * i], data[3 * i + 1],
+                                    data[3 * i + 2]);
+    DMDIF_writeData(color);
+  }
+  advanceCursor(numPixels);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws RGB565 pixels to the display
+*
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param data
+*  Array containing the pixel data, one RGB565 value per pixel. The pixels are
+*  ordered by increasing x coordinate, after the last pixel of a row, the next
+*  pixel will be the first pixel on the next row.
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeDataRGB565(uint16_t x, uint16_t y, const uint16_t data[],
+                             uint32_t numPixels)
+{
+  uint32_t statusCode;
+  uint32_t clipRemaining;
+  uint32_t i;
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  /* Set the address of the first pixel */
+  statusCode = setPixelAddress(x, y, numPixels);
+  if (statusCode != DMD_OK)
+  {
+    return statusCode;
+  }
+
+  /* Number of pixels from the first pixel (given by x and y) to the end
+   * of the clipping area */
+  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
+                  dimensions.clipWidth - x;
+
+  /* Check that the length of data isn't longer than the number of pixels
+   * in the rest of the clipping area */
+  if (numPixels > clipRemaining)
+  {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+
+  /* Write data */
+  prepareDataWrite();
+  for (i = 0; i < numPixels; i++)
+  {
+    DMDIF_writeData(data[i]);
+  }
+  advanceCursor(numPixels);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws pixels that are already in the native pixel format of the display
+*
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param data
+*  Array containing the pixel data, one RGB565 value per pixel, see
+*  DMD_colorNative(). The pixels are ordered by increasing x coordinate, after
+*  the last pixel of a row, the next pixel will be the first pixel on the next
+*  row.
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeDataNative(uint16_t x, uint16_t y, const uint32_t data[],
+                             uint32_t numPixels)
+{
+  uint32_t statusCode;
+  uint32_t clipRemaining;
+  uint32_t i;
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  /* Set the address of the first pixel */
+  statusCode = setPixelAddress(x, y, numPixels);
+  if (statusCode != DMD_OK)
+  {
+    return statusCode;
+  }
+
+  /* Number of pixels from the first pixel (given by x and y) to the end
+   * of the clipping area */
+  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
+                  dimensions.clipWidth - x;
+
+  /* Check that the length of data isn't longer than the number of pixels
+   * in the rest of the clipping area */
+  if (numPixels > clipRemaining)
+  {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+
+  /* Write data */
+  prepareDataWrite();
+  for (i = 0; i < numPixels; i++)
+  {
+    DMDIF_writeData(data[i]);
+  }
+  advanceCursor(numPixels);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws pixels to the display at location x,y, from a source data array in
+*  GIMP RLE compressed C-format, mixing with another RGB color to create a
+*  "blended" look or for fading images in and out
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param data
+*  Array containing the pixel data in GIMP RLE compressed format
+*  @param numPixels
+*  Number of pixels to be written
+*  @param red
+*  Red component of color to mix with orignal
+*  @param green
+*  Red component of color to mix with orignal
+*  @param blue
+*  Red component of color to mix with orignal
+*  @param weight
+*  Ratio to which red/green/blue component and original color should be combined
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeDataRLEFade(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
+			      const uint8_t *data,
+			      int red, int green, int blue, int weight)
+{
+   uint32_t color = 0;
+   int xpos, ypos;
+   const uint8_t *ptr;
+   int r,g,b;
+   uint8_t readRGB = 0;
+   uint8_t copyColor = 0;
+
+
+   ptr = data;
+   for (ypos = y; ypos < (ylen+y); ypos++){
+
+      setPixelAddress(x, ypos, xlen);
+      prepareDataWrite();
+
+      for (xpos = x; xpos < (xlen+x); xpos++){
+
+         if ( readRGB ) {
+            readRGB--;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            r = ((r * weight/100) + (red * (100-weight)/100));
+            g = ((g * weight/100) + (green * (100-weight)/100));
+            b = ((b * weight/100) + (blue * (100-weight)/100));
+            color = colorTransform24To16bpp(r,g,b);
+            DMDIF_writeData(color);
+            continue;
+         }
+         if ( copyColor ) {
+            copyColor--;
+            DMDIF_writeData( color );
+            continue;
+         }
+         if ( *ptr & 0x80 ) {
+            copyColor = (*ptr - 0x80);
+            ptr++;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            r = ((r * weight/100) + (red * (100-weight)/100));
+            g = ((g * weight/100) + (green * (100-weight)/100));
+            b = ((b * weight/100) + (blue * (100-weight)/100));
+            copyColor--;
+         }
+         else {
+            readRGB = *ptr;
+            ptr++;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            r = ((r * weight/100) + (red * (100-weight)/100));
+            g = ((g * weight/100) + (green * (100-weight)/100));
+            b = ((b * weight/100) + (blue * (100-weight)/100));
+            readRGB--;
+         }
+
+         color = colorTransform24To16bpp(r,g,b);
+         DMDIF_writeData( color );
+
+      }
+      advanceCursor(xlen);
+
+   }
+
+   return DMD_OK;
+
+}
+
+
+/**************************************************************************//**
+*  @brief
+*  Draws pixels to the display at location x,y, from a source data array in
+*  GIMP RLE compressed C-format
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param data
+*  Array containing the pixel data in GIMP RLE compressed format
+*  @param numPixels
+*  Number of pixels to be written
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeDataRLE(uint16_t x, uint16_t y, uint16_t xlen, uint16_t ylen,
+                          const uint8_t *data)
+{
+   uint32_t color = 0;
+   int xpos, ypos;
+   const uint8_t *ptr;
+   uint8_t r,g,b;
+   uint8_t readRGB = 0;
+   uint8_t copyColor = 0;
+
+   ptr = data;
+   for (ypos = y; ypos < (ylen+y); ypos++){
+
+      setPixelAddress(x, ypos, xlen);
+      prepareDataWrite();
+      for (xpos = x; xpos < (xlen+x); xpos++){
+
+         if ( readRGB ) {
+            readRGB--;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            color = colorTransform24To16bpp(r,g,b);
+            DMDIF_writeData(color);
+            continue;
+         }
+         if ( copyColor ) {
+            copyColor--;
+            DMDIF_writeData( color );
+            continue;
+         }
+
+         if ( *ptr & 0x80 ) {
+            copyColor = (*ptr - 0x80);
+            ptr++;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            copyColor--;
+         } else {
+            readRGB = *ptr;
+            ptr++;
+            r = *ptr++;
+            g = *ptr++;
+            b = *ptr++;
+            readRGB--;
+         }
+
+         color = colorTransform24To16bpp(r,g,b);
+         DMDIF_writeData( color );
+
+      }
+      advanceCursor(xlen);
+
+   }
+
+   return DMD_OK;
+
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads data from display memory
+*
+*  @param x
+*  X coordinate of the first pixel to be read, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be read, relative to the clipping area
+*  @param data
+*  Pointer to where the pixel data will be stored
+*  @param numPixels
+*  Number of pixels to be read
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_readData(uint16_t x, uint16_t y,
+                      uint8_t data[], uint32_t numPixels)
+{
+  uint32_t statusCode;
+  uint32_t clipRemaining;
+  uint32_t i;
+  uint32_t color;
+  uint8_t  red, green, blue;
+
+  if (!initialized)
+  {
+    return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+  }
+
+  /* Set the address of the first pixel */
+  statusCode = setPixelAddress(x, y, numPixels);
+  if (statusCode != DMD_OK)
+  {
+    return statusCode;
+  }
+
+  /* Number of pixels from the first pixel (given by x and y) to the end
+   * of the clipping area */
+  clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
+                  dimensions.clipWidth - x;
+  /* Check that the length of data isn't longer than the number of pixels
+   * in the rest of the clipping area */
+  if (numPixels > clipRemaining)
+  {
+    return DMD_ERROR_TOO_MUCH_DATA;
+  }
+
+  /* Read data */
+  prepareDataRead();
+  for (i = 0; i < numPixels; i++)
+  {
+    /* Dummy read  */
+    color = DMDIF_readData();
+    /* Read the color value */
+    color = DMDIF_readData();
+
+    /* Transform into 24bpp */
+    colorTransform16To24bpp(color, &red, &green, &blue);
+
+    data[3 * i]     = red;
+    data[3 * i + 1] = green;
+    data[3 * i + 2] = blue;
+
+    /* Update the position. This is not done automatically for reading, so
+     * it must be set for every read. */
+    x++;
+    if (x >= dimensions.clipWidth)
+    {
+      y++;
+      x = 0;
+      if (y >= dimensions.clipHeight)
+      {
+        y = 0;
+      }
+    }
+
+    statusCode = setPixelAddress(x, y, 1);
+    if (statusCode != DMD_OK)
+    {
+      return statusCode;
+    }
+
+    /* Setting the address selects another register, so the data access
+     * command must be sent again before the next read */
+    prepareDataRead();
+  }
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  \brief
+*  Draws a number of pixels of the same color to the display
+*
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param red
+*  Red component of the color
+*  @param green
+*  Green component of the color
+*  @param blue
+*  Blue component of the color
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeColor(uint16_t x, uint16_t y, uint8_t red,
+                        uint8_t green, uint8_t blue, uint32_t numPixels)
+{
+   return DMD_writeColorNative(x, y, colorTransform24To16bpp(red, green, blue),
+                               numPixels);
+}
+
+/**************************************************************************//**
+*  \brief
+*  Draws a number of pixels of the same color to the display, with the color
+*  already in the native pixel format of the display
+*
+*  @param x
+*  X coordinate of the first pixel to be written, relative to the clipping area
+*  @param y
+*  Y coordinate of the first pixel to be written, relative to the clipping area
+*  @param color
+*  RGB565 color, see DMD_colorNative()
+*  @param numPixels
+*  Number of pixels to be written
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_writeColorNative(uint16_t x, uint16_t y, uint32_t color,
+                              uint32_t numPixels)
+{
+
+   uint32_t clipRemaining;
+   uint32_t statusCode;
+
+   if (!initialized){
+      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+   }
+
+   /* Set the address of the first pixel */
+   statusCode = setPixelAddress(x, y, numPixels);
+   if (statusCode != DMD_OK){
+      return statusCode;
+   }
+
+   /* Number of pixels from the first pixel (given by x and y) to the end
+    * of the clipping area */
+   clipRemaining = (dimensions.clipHeight - y - 1) * dimensions.clipWidth +
+      dimensions.clipWidth - x;
+
+   /* Check that the length of data isn't longer than the number of pixels
+    * in the rest of the clipping area */
+   if (numPixels > clipRemaining){
+      return DMD_ERROR_TOO_MUCH_DATA;
+   }
+
+   /* Write data */
+   prepareDataWrite();
+   DMDIF_writeDataRepeated(color, numPixels);
+   advanceCursor(numPixels);
+
+   return DMD_OK;
+
+}
+
+/**************************************************************************//**
+*  @brief
+*  Converts a 24bpp color to the native pixel format of the display, so it
+*  can be passed to DMD_writeColorNative() and DMD_writeDataNative()
+*
+*  @param red
+*  8-bit red component of the color
+*  @param green
+*  8-bit green component of the color
+*  @param blue
+*  8-bit blue component of the color
+*
+*  @return
+*  RGB565 value of the color
+******************************************************************************/
+uint32_t DMD_colorNative(uint8_t red, uint8_t green, uint8_t blue){
+   return colorTransform24To16bpp(red, green, blue);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Turns off the display and puts it into sleep mode
+*  Does not turn off backlight
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_sleep(void){
+
+   uint16_t data;
+
+   if (!initialized){
+      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+   }
+
+   /* Put into sleep mode */
+   data = DMD_SSD2119_SLEEP_MODE_1_SLP;
+   writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
+
+   /* Turn off display */
+   data = 0;
+   writeReg(DMD_SSD2119_DISPLAY_CONTROL, 0x0000);
+
+   /* Delay 1.5 frame */
+   /*DMDIF_delay((1000 / DMD_FRAME_FREQUENCY) * 3 / 2);*/
+
+   return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Wakes up the display from sleep mode
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_wakeUp(void){
+
+   uint16_t data;
+
+   if (!initialized){
+      return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+   }
+
+   /* Get out of sleep mode */
+   data = 0;
+   writeReg(DMD_SSD2119_SLEEP_MODE_1, data);
+
+   /* Turn on display */
+   data  = DMD_SSD2119_DISPLAY_CONTROL_DTE;
+   data |= DMD_SSD2119_DISPLAY_CONTROL_GON;
+   data |= DMD_SSD2119_DISPLAY_CONTROL_D1;
+   data |= DMD_SSD2119_DISPLAY_CONTROL_D0;
+   writeReg(DMD_SSD2119_DISPLAY_CONTROL, 0x0033);
+
+   /* Delay 10 frames */
+   /*DMDIF_delay((1000 / DMD_FRAME_FREQUENCY) * 10);*/
+
+   return DMD_OK;
+
+}
+
+/**************************************************************************//**
+*  @brief
+*  Transforms a 24bpp pixel data into an 16bpp pixel
+*
+*  @param red
+*  8-bit red component of the pixel
+*  @param green
+*  8-bit green component of the pixel
+*  @param blue
+*  8-bit blue component of the pixel
+*  @return
+*  16bpp value of pixel
+******************************************************************************/
+static uint32_t colorTransform24To16bpp(uint8_t red, uint8_t green, uint8_t blue){
+
+   /* Transform each color into 6 bits by dropping the 2 LSB */
+   red   = (red >> 3) & 0x1F;
+   green = (green >> 2) & 0x3F;
+   blue  = (blue >> 3) & 0x1F;
+
+   /* Put it together to one 16bpp color number */
+   return (red << 11) | (green << 5) | blue;
+
+}
+
+/**************************************************************************//**
+*  @brief
+*  Transforms an 18 bpp pixel into a 24bpp pixel
+*
+*  @param color
+*  16bpp color pixel
+*  @param red
+*  return value for red component of 24bpp pixel
+*  @param green
+*  return value for green component of 24bpp pixel
+*  @param blue
+*  return value for blue component of 24bpp pixel
+******************************************************************************/
+static void colorTransform16To24bpp(uint32_t color, uint8_t *red,
+                                    uint8_t *green, uint8_t *blue){
+
+  /* Get the individual colors out of the 16bpp number */
+  uint8_t redValue   = (color & 0x0000F800) >> 11;
+  uint8_t greenValue = (color & 0x000007E0) >> 5;
+  uint8_t blueValue  = (color & 0x0000001F);
+
+  /* Convert each color to 8-bit */
+  redValue   <<= 3;
+  greenValue <<= 2;
+  blueValue  <<= 3;
+
+  *red   = redValue;
+  *green = greenValue;
+  *blue  = blueValue;
+
+  return;
+
+}
+
+
+/**************************************************************************//**
+*  @brief
+*  Set horizontal and vertical flip mode of display controller
+*
+*  @param hor
+*  Set to flip display horizontally
+*
+*  @param ver
+*  Set to flip display vertically
+*
+*  @return
+*  Returns DMD_OK is successful, error otherwise.
+******************************************************************************/
+EMSTATUS DMD_flipDisplay(int horizontal, int vertical){
+
+  uint16_t reg;
+
+  reg = rcDriverOutputControl;
+
+  if (horizontal) reg &= ~DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
+  else reg |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_RL;
+
+  if (vertical) reg &= ~DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
+  else reg |= DMD_SSD2119_DRIVER_OUTPUT_CONTROL_TB;
+
+  rcDriverOutputControl = reg;
+  writeReg(DMD_SSD2119_DRIVER_OUTPUT_CONTROL, rcDriverOutputControl);
+
+  return DMD_OK;
+
+}
+
+/**************************************************************************//**
+*  @brief
+*  Get the bus transaction counters accumulated since initialization or the
+*  last call to DMD_resetStats()
+*
+*  @param stats
+*  Pointer to the structure that receives the counters
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_getStats(DMD_Stats *stats)
+{
+  EMSTATUS status;
+
+  /* Bus level counters are kept by the interface */
+  status = DMDIF_getStats(stats);
+  if (status != DMD_OK)
+  {
+    return status;
+  }
+
+  stats->addressSetups = statAddressSetups;
+  stats->windowSetups  = statWindowSetups;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reset the bus transaction counters
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMD_resetStats(void)
+{
+  statAddressSetups = 0;
+  statWindowSetups  = 0;
+
+  return DMDIF_resetStats();
+}
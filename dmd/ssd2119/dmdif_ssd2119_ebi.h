@@ -1,50 +1,53 @@
- /*************************************************************************//**
- * @file dmd_if_ssd2119_ebi.h
- * @brief Dot matrix display SSD2119 interface using EBI
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-#ifndef __DMD_IF_SSD2119_EBI_H_
-#define __DMD_IF_SSD2119_EBI_H_
-
-#include <stdint.h>
-
-/* Module Prototypes */
-EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr);
-EMSTATUS DMDIF_writeReg(uint8_t reg, uint16_t data);
-uint16_t DMDIF_readDeviceCode(void);
-EMSTATUS DMDIF_prepareDataAccess(void);
-EMSTATUS DMDIF_writeData(uint32_t data);
-EMSTATUS DMDIF_writeDataRepeated(uint32_t data, int len);
-uint32_t DMDIF_readData(void);
-EMSTATUS DMDIF_delay(uint32_t ms);
-
-#endif
+ /*************************************************************************//**
+ * @file dmd_if_ssd2119_ebi.h
+ * @brief Dot matrix display SSD2119 interface using EBI
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+#ifndef __DMD_IF_SSD2119_EBI_H_
+#define __DMD_IF_SSD2119_EBI_H_
+
+#include <stdint.h>
+#include "dmd_ssd2119.h"
+
+/* Module Prototypes */
+EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr);
+EMSTATUS DMDIF_writeReg(uint8_t reg, uint16_t data);
+uint16_t DMDIF_readDeviceCode(void);
+EMSTATUS DMDIF_prepareDataAccess(void);
+EMSTATUS DMDIF_writeData(uint32_t data);
+EMSTATUS DMDIF_writeDataRepeated(uint32_t data, int len);
+uint32_t DMDIF_readData(void);
+EMSTATUS DMDIF_delay(uint32_t ms);
+EMSTATUS DMDIF_getStats(DMD_Stats *stats);
+EMSTATUS DMDIF_resetStats(void);
+
+#endif
@@ -0,0 +1,550 @@
+/*************************************************************************//***
+ * @file dmdif_ssd2119_sim.c
+ * @brief Dot matrix display SSD2119 interface using an in-memory controller
+ *        model, for host builds
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* This interface replaces the EBI/SPI interfaces on host builds. It links
+ * against dmd_ssd2119.c or dmd_ssd2119_16bit.c and keeps the registers and the
+ * graphics RAM of the controller in memory, so that the contents of the GRAM
+ * can be inspected after drawing. The model follows the register semantics in
+ * dmd_ssd2119_registers.h:
+ *
+ * - R44h/R45h/R46h define the window the address counter wraps within
+ * - R4Eh/R4Fh set the X/Y address counter
+ * - The ID and AM bits of R11h select the direction the counter moves in
+ * - The DFM bits of R11h select whether pixel data is 18bpp or RGB565
+ *
+ * glib/tools/glib_simcheck.c draws through GLIB into this model and checks
+ * the result on the host.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "dmd_ssd2119_registers.h"
+#include "dmd_ssd2119.h"
+#include "dmdif_ssd2119_sim.h"
+
+/** Number of register indexes the controller can address */
+#define SIM_REGISTER_COUNT    256
+
+/* Local function prototypes */
+static void writeRegister(uint8_t reg, uint32_t data);
+static void writeGram(uint32_t data);
+static void advanceAddressCounter(void);
+static uint32_t colorTransformToGram(uint32_t data);
+static uint32_t colorTransformFromGram(uint32_t color);
+
+/* Local variables */
+static uint16_t registers[SIM_REGISTER_COUNT];
+static uint32_t gram[DMD_VERTICAL_SIZE][DMD_HORIZONTAL_SIZE];
+static uint8_t  indexRegister;
+static uint16_t xAddress;
+static uint16_t yAddress;
+static uint32_t dummyReadPending;
+
+/* Bus transaction counters */
+static DMD_Stats busStats;
+
+/**************************************************************************//**
+*  @brief
+*  Initializes the simulated LCD controller SSD2119. All registers are set to
+*  their reset values and the graphics RAM is cleared.
+*
+*  @param cmdRegAddr
+*  Not used by the simulator
+*  @param dataRegAddr
+*  Not used by the simulator
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr)
+{
+  (void) cmdRegAddr;
+  (void) dataRegAddr;
+
+  memset(registers, 0, sizeof(registers));
+  memset(gram, 0, sizeof(gram));
+
+  /* Reset values of the registers the model depends on */
+  registers[DMD_SSD2119_ENTRY_MODE] =
+    (DMD_SSD2119_ENTRY_MODE_DFM_65K << DMD_SSD2119_ENTRY_MODE_DFM_SHIFT) |
+    DMD_SSD2119_ENTRY_MODE_DENMODE |
+    DMD_SSD2119_ENTRY_MODE_ID1 |
+    DMD_SSD2119_ENTRY_MODE_ID0;
+  registers[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS] =
+    (DMD_VERTICAL_SIZE - 1) << DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT;
+  registers[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS] = 0;
+  registers[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS]   = DMD_HORIZONTAL_SIZE - 1;
+
+  indexRegister    = 0;
+  xAddress         = 0;
+  yAddress         = 0;
+  dummyReadPending = 0;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a value to a control register in the LCD controller
+*
+*  @param reg
+*  The register that will be written to
+*  @param data
+*  The value to write to the register
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_writeReg(uint8_t reg, uint16_t data)
+{
+  busStats.regWrites++;
+  busStats.indexWrites++;
+
+  indexRegister = reg;
+
+  writeRegister(reg, data);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads the device code of the LCD controller
+*
+*  @return
+*  The device code of the LCD controller
+******************************************************************************/
+uint16_t DMDIF_readDeviceCode(void)
+{
+  busStats.indexWrites++;
+
+  indexRegister = DMD_SSD2119_DEVICE_CODE_READ;
+
+  return DMDIF_SIM_DEVICE_CODE;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sends the data access command to the LCD controller to prepare for one or more
+*  writes or reads using the DMDIF_writeData() and DMDIF_readData()
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_prepareDataAccess(void)
+{
+  busStats.indexWrites++;
+
+  indexRegister = DMD_SSD2119_ACCESS_DATA;
+
+  /* The first read after selecting the GRAM returns invalid data */
+  dummyReadPending = 1;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes one pixel to the LCD controller. DMDIF_prepareDataAccess() needs to be
+*  called before writing data using this function.
+*
+*  @param data
+*  The color value of the pixel to be written, in 18bpp or RGB565 format
+*  depending on the DFM setting of the entry mode register
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_writeData(uint32_t data)
+{
+  busStats.dataWrites++;
+
+  writeRegister(indexRegister, data);
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the same pixel to the LCD controller a number of times.
+*  DMDIF_prepareDataAccess() needs to be called before writing data using this
+*  function.
+*
+*  @param data
+*  The color value of the pixel to be written, in 18bpp or RGB565 format
+*  depending on the DFM setting of the entry mode register
+*  @param len
+*  Number of times to write the pixel
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_writeDataRepeated(uint32_t data, int len)
+{
+  int i;
+
+  busStats.dataWrites += len;
+
+  for (i = 0; i < len; i++)
+  {
+    writeRegister(indexRegister, data);
+  }
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads one pixel from the memory of the LCD controller.
+*  DMDIF_prepareDataAccess() needs to be called before using this function.
+*  The first read after DMDIF_prepareDataAccess() is a dummy read. Reading does
+*  not move the address counter.
+*
+*  @return
+*  Value of pixel, in 18bpp or RGB565 format depending on the DFM setting of
+*  the entry mode register
+******************************************************************************/
+uint32_t DMDIF_readData(void)
+{
+  busStats.dataReads++;
+
+  if (indexRegister != DMD_SSD2119_ACCESS_DATA)
+  {
+    return registers[indexRegister];
+  }
+
+  if (dummyReadPending)
+  {
+    dummyReadPending = 0;
+    return 0;
+  }
+
+  return colorTransformFromGram(gram[yAddress][xAddress]);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Delays the program a given number of milliseconds. The simulator has no
+*  timing, so this returns immediately.
+*
+*  @param reg
+*  Number of milliseconds to delay.
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_delay(uint32_t ms)
+{
+  (void) ms;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the bus transaction counters of the interface. The address and
+*  window setup counters are kept by the display driver and are set to zero.
+*
+*  @param stats
+*  Pointer to the structure that receives the counters
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_getStats(DMD_Stats *stats)
+{
+  *stats = busStats;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Resets the bus transaction counters of the interface
+*
+*  @return
+*  DMD_OK on success, otherwise error code
+******************************************************************************/
+EMSTATUS DMDIF_resetStats(void)
+{
+  busStats.regWrites   = 0;
+  busStats.indexWrites = 0;
+  busStats.dataWrites  = 0;
+  busStats.dataReads   = 0;
+
+  return DMD_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the contents of the graphics RAM at a given address
+*
+*  @param x
+*  X address in the graphics RAM
+*  @param y
+*  Y address in the graphics RAM
+*
+*  @return
+*  18bpp value of pixel, or 0 if the address is outside the graphics RAM
+******************************************************************************/
+uint32_t DMDIF_simGetPixel(uint16_t x, uint16_t y)
+{
+  if (x >= DMD_HORIZONTAL_SIZE || y >= DMD_VERTICAL_SIZE)
+  {
+    return 0;
+  }
+
+  return gram[y][x];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the contents of the graphics RAM at a given address as 24bpp
+*  color components
+*
+*  @param x
+*  X address in the graphics RAM
+*  @param y
+*  Y address in the graphics RAM
+*  @param red
+*  return value for red component of 24bpp pixel
+*  @param green
+*  return value for green component of 24bpp pixel
+*  @param blue
+*  return value for blue component of 24bpp pixel
+******************************************************************************/
+void DMDIF_simGetPixelRGB(uint16_t x, uint16_t y,
+                          uint8_t *red, uint8_t *green, uint8_t *blue)
+{
+  uint32_t color = DMDIF_simGetPixel(x, y);
+
+  *red   = ((color & 0x0003F000) >> 12) << 2;
+  *green = ((color & 0x00000FC0) >> 6) << 2;
+  *blue  = (color & 0x0000003F) << 2;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the last value written to a register
+*
+*  @param reg
+*  The register to read
+*
+*  @return
+*  The register value
+******************************************************************************/
+uint16_t DMDIF_simGetRegister(uint8_t reg)
+{
+  return registers[reg];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the current position of the address counter
+*
+*  @param x
+*  return value for the X address
+*  @param y
+*  return value for the Y address
+******************************************************************************/
+void DMDIF_simGetAddressCounter(uint16_t *x, uint16_t *y)
+{
+  *x = xAddress;
+  *y = yAddress;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Handles a data write to the register selected by the index register
+*
+*  @param reg
+*  The register selected by the index register
+*  @param data
+*  The data written
+******************************************************************************/
+static void writeRegister(uint8_t reg, uint32_t data)
+{
+  switch (reg)
+  {
+  case DMD_SSD2119_ACCESS_DATA:
+    writeGram(data);
+    return;
+
+  case DMD_SSD2119_SET_X_ADDRESS_COUNTER:
+    xAddress = data % DMD_HORIZONTAL_SIZE;
+    break;
+
+  case DMD_SSD2119_SET_Y_ADDRESS_COUNTER:
+    yAddress = data % DMD_VERTICAL_SIZE;
+    break;
+
+  default:
+    break;
+  }
+
+  registers[reg] = (uint16_t) data;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes one pixel at the address counter and moves the address counter
+*
+*  @param data
+*  The pixel, in the format selected by the DFM bits of the entry mode register
+******************************************************************************/
+static void writeGram(uint32_t data)
+{
+  gram[yAddress][xAddress] = colorTransformToGram(data);
+
+  advanceAddressCounter();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Moves the address counter to the next pixel inside the window set by
+*  R44h-R46h, in the direction given by the ID and AM bits of the entry mode
+*  register. The counter wraps to the opposite edge at the window edges.
+******************************************************************************/
+static void advanceAddressCounter(void)
+{
+  uint16_t entryMode = registers[DMD_SSD2119_ENTRY_MODE];
+  uint16_t verticalPos = registers[DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS];
+  uint16_t xStart = registers[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_START_POS];
+  uint16_t xEnd   = registers[DMD_SSD2119_HORIZONTAL_RAM_ADDRESS_END_POS];
+  uint16_t yStart = (verticalPos >> DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_START_SHIFT) & 0xff;
+  uint16_t yEnd   = (verticalPos >> DMD_SSD2119_VERTICAL_RAM_ADDRESS_POS_END_SHIFT) & 0xff;
+  int      xInc   = (entryMode & DMD_SSD2119_ENTRY_MODE_ID0) != 0;
+  int      yInc   = (entryMode & DMD_SSD2119_ENTRY_MODE_ID1) != 0;
+  int      xWrap;
+  int      yWrap;
+
+  /* Wrap at the window edge in the direction of movement */
+  xWrap = xInc ? (xAddress >= xEnd) : (xAddress <= xStart);
+  yWrap = yInc ? (yAddress >= yEnd) : (yAddress <= yStart);
+
+  if (entryMode & DMD_SSD2119_ENTRY_MODE_AM)
+  {
+    /* Vertical update: move along the column, then to the next column */
+    if (!yWrap)
+    {
+      yAddress = yInc ? yAddress + 1 : yAddress - 1;
+      return;
+    }
+    yAddress = yInc ? yStart : yEnd;
+    if (!xWrap)
+    {
+      xAddress = xInc ? xAddress + 1 : xAddress - 1;
+    }
+    else
+    {
+      xAddress = xInc ? xStart : xEnd;
+    }
+  }
+  else
+  {
+    /* Horizontal update: move along the row, then to the next row */
+    if (!xWrap)
+    {
+      xAddress = xInc ? xAddress + 1 : xAddress - 1;
+      return;
+    }
+    xAddress = xInc ? xStart : xEnd;
+    if (!yWrap)
+    {
+      yAddress = yInc ? yAddress + 1 : yAddress - 1;
+    }
+    else
+    {
+      yAddress = yInc ? yStart : yEnd;
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Transforms pixel data from the interface into the 18bpp format stored in
+*  the graphics RAM. In 65K mode the 5-bit red and blue components are
+*  extended to 6 bits by repeating the MSB.
+*
+*  @param data
+*  The pixel in the format selected by the DFM bits
+*  @return
+*  18bpp value of pixel
+******************************************************************************/
+static uint32_t colorTransformToGram(uint32_t data)
+{
+  uint16_t dfm;
+  uint32_t red, green, blue;
+
+  dfm = (registers[DMD_SSD2119_ENTRY_MODE] >> DMD_SSD2119_ENTRY_MODE_DFM_SHIFT) & 0x3;
+  if (dfm != DMD_SSD2119_ENTRY_MODE_DFM_65K)
+  {
+    return data & 0x0003FFFF;
+  }
+
+  red   = (data & 0xF800) >> 11;
+  green = (data & 0x07E0) >> 5;
+  blue  = (data & 0x001F);
+
+  red  = (red << 1) | (red >> 4);
+  blue = (blue << 1) | (blue >> 4);
+
+  return (red << 12) | (green << 6) | blue;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Transforms an 18bpp pixel from the graphics RAM into the format selected
+*  by the DFM bits
+*
+*  @param color
+*  18bpp value of pixel
+*  @return
+*  The pixel in the format selected by the DFM bits
+******************************************************************************/
+static uint32_t colorTransformFromGram(uint32_t color)
+{
+  uint16_t dfm;
+
+  dfm = (registers[DMD_SSD2119_ENTRY_MODE] >> DMD_SSD2119_ENTRY_MODE_DFM_SHIFT) & 0x3;
+  if (dfm != DMD_SSD2119_ENTRY_MODE_DFM_65K)
+  {
+    return color;
+  }
+
+  return (((color & 0x0003F000) >> 13) << 11) |
+         (((color & 0x00000FC0) >> 6) << 5) |
+         ((color & 0x0000003F) >> 1);
+}
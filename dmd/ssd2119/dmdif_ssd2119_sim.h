@@ -0,0 +1,64 @@
+ /*************************************************************************//**
+ * @file dmdif_ssd2119_sim.h
+ * @brief Dot matrix display SSD2119 interface using an in-memory controller
+ *        model, for host builds
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+#ifndef __DMDIF_SSD2119_SIM_H_
+#define __DMDIF_SSD2119_SIM_H_
+
+#include <stdint.h>
+#include "dmd_ssd2119.h"
+
+/** Device code reported by the simulated controller */
+#define DMDIF_SIM_DEVICE_CODE    0x9919
+
+/* Module Prototypes */
+EMSTATUS DMDIF_init(uint32_t cmdRegAddr, uint32_t dataRegAddr);
+EMSTATUS DMDIF_writeReg(uint8_t reg, uint16_t data);
+uint16_t DMDIF_readDeviceCode(void);
+EMSTATUS DMDIF_prepareDataAccess(void);
+EMSTATUS DMDIF_writeData(uint32_t data);
+EMSTATUS DMDIF_writeDataRepeated(uint32_t data, int len);
+uint32_t DMDIF_readData(void);
+EMSTATUS DMDIF_delay(uint32_t ms);
+EMSTATUS DMDIF_getStats(DMD_Stats *stats);
+EMSTATUS DMDIF_resetStats(void);
+
+/* Simulator inspection */
+uint32_t DMDIF_simGetPixel(uint16_t x, uint16_t y);
+void DMDIF_simGetPixelRGB(uint16_t x, uint16_t y,
+                          uint8_t *red, uint8_t *green, uint8_t *blue);
+uint16_t DMDIF_simGetRegister(uint8_t reg);
+void DMDIF_simGetAddressCounter(uint16_t *x, uint16_t *y);
+
+#endif
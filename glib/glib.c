@@ -1,372 +1,894 @@
- /*************************************************************************//**
- * @file glib.c
- * @brief Energy Micro Graphics Library: General Routines
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-/* Standard C header files */
-#include <stdint.h>
-
-/* EM types */
-#include "em_types.h"
-
-/* GLIB files */
-#include "glib.h"
-
-/**************************************************************************//**
-*  @brief
-*  Initialize the GLIB_Context
-*
-*  The context is set to default values and gets information about the display
-*  from the display driver.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_contextInit(GLIB_Context *pContext)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status;
-
-  /* Sets the default background color */
-  pContext->backgroundColor = Black;
-
-  /* Sets the default foreground color */
-  pContext->foregroundColor = White;
-
-  /* Sets a pointer to the display geometry struct */
-  DMD_DisplayGeometry *pTmpDisplayGeometry;
-  status = DMD_getDisplayGeometry(&pTmpDisplayGeometry);
-  if (status != 0) return status;
-
-  pContext->pDisplayGeometry = pTmpDisplayGeometry;
-
-  /* Sets the clipping region to the whole display */
-  GLIB_Rectangle tmpRect = { 0, 0, pTmpDisplayGeometry->xSize - 1, pTmpDisplayGeometry->ySize - 1 };
-  status = GLIB_setClippingRegion(pContext, &tmpRect);
-  if (status != 0) return status;
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Returns the display from sleep mode
-*
-*  @return
-*  Returns DMD_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_displayWakeUp()
-{
-  /* Use display driver's wake up function */
-  return DMD_wakeUp();
-}
-
-/**************************************************************************//**
-*  @brief
-*  Sets the display in sleep mode
-*
-*  @return
-*  Returns DMD_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_displaySleep()
-{
-  /* Use Display Driver sleep function */
-  return DMD_sleep();
-}
-
-/**************************************************************************//**
-*  @brief
-*  Sets the clippingRegion of the passed in GLIB_Context
-*
-*  @param pContext
-*  Pointer to a GLIB_Context
-*  @param pRect
-*  Pointer to a GLIB_Rectangle which is the clipping region to be set.
-*
-*  @return
-*  - Returns GLIB_OK on success
-*  - Returns GLIB_INVALID_CLIPPINGREGION if invalid coordinates
-*  - Returns GLIB_OUT_OF_BOUNDS if clipping region is bigger than display clipping
-*  area
-******************************************************************************/
-
-EMSTATUS GLIB_setClippingRegion(GLIB_Context *pContext, GLIB_Rectangle *pRect)
-{
-  /* Check arguments */
-  if (pContext == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
-
-  /* Check coordinates against the display region */
-  if ((pRect->xMin >= pRect->xMax) || (pRect->yMin >= pRect->yMax)) return GLIB_INVALID_CLIPPINGREGION;
-  if (pRect->xMax > pContext->pDisplayGeometry->clipWidth) return GLIB_OUT_OF_BOUNDS;
-  if (pRect->yMax > pContext->pDisplayGeometry->clipHeight) return GLIB_OUT_OF_BOUNDS;
-
-  GLIB_Rectangle tmpRect = { pRect->xMin, pRect->yMin, pRect->xMax, pRect->yMax };
-
-  pContext->clippingRegion = tmpRect;
-
-  return GLIB_OK;
-}
-
-
-/**************************************************************************//**
-*  @brief
-*  Clears the display with the background color of the GLIB_Context
-*
-*  @param pContext
-*  Pointer to a GLIB_Context which holds the backgroundcolor.
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_clear(const GLIB_Context *pContext)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status;
-
-  uint8_t  red;
-  uint8_t  green;
-  uint8_t  blue;
-  /* Divide the 24-color into it's components */
-  GLIB_colorTranslate24bpp(pContext->backgroundColor, &red, &green, &blue);
-
-  /* Reset display driver clipping area */
-  status = GLIB_resetDisplayClippingArea(pContext);
-  if (status != 0) return status;
-
-  uint16_t width  = pContext->pDisplayGeometry->clipWidth;
-  uint16_t height = pContext->pDisplayGeometry->clipHeight;
-  /* Fill the display with the background color of the GLIB_Context  */
-
-  status = DMD_writeColor(0, 0, red, green, blue, width * height);
-  if (status != 0) return status;
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Reset the display driver clipping area to the whole display
-*
-*  @param pContext
-*  Pointer to a GLIB_Context
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_resetDisplayClippingArea(const GLIB_Context *pContext)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status = DMD_setClippingArea(0, 0, pContext->pDisplayGeometry->xSize,
-                                        pContext->pDisplayGeometry->ySize);
-  if (status != DMD_OK) return status;
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Reset the GLIB_Context clipping region to the whole display
-*
-*  @param pContext
-*  Pointer to a GLIB_Context
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_resetClippingRegion(GLIB_Context *pContext)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  GLIB_Rectangle tmpRect;
-  tmpRect.xMin = pContext->pDisplayGeometry->xClipStart;
-  tmpRect.yMin = pContext->pDisplayGeometry->yClipStart;
-  tmpRect.xMax = tmpRect.xMin + pContext->pDisplayGeometry->clipWidth - 1;
-  tmpRect.yMax = tmpRect.yMin + pContext->pDisplayGeometry->clipHeight - 1;
-
-  pContext->clippingRegion = tmpRect;
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Extracts the color components from the 32-bit color passed and puts them in
-*  the passed in 8-bits ints. The color is 24-bit RGB.
-*
-*  Example: color = 0x00FFFF00 -> red = 0xFF, green = 0xFF, blue = 0x00.
-*
-*  @param color
-*  The color which is to be translated
-*  @param red
-*  Pointer to a uint8_t holding the red component
-*  @param green
-*  Pointer to a uint8_t holding the green component
-*  @param blue
-*  Pointer to a uint8_t holding the blue component
-*
-*  @return
-*  None.
-******************************************************************************/
-
-void GLIB_colorTranslate24bpp(uint32_t color, uint8_t *red, uint8_t *green, uint8_t *blue)
-{
-  *red   = (color & RedMask) >> RedShift;
-  *green = (color & GreenMask) >> GreenShift;
-  *blue  = (color & BlueMask) >> BlueShift;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Convert 3 uint8_t color components into a 24-bit color
-*
-*  Example: red = 0xFF, green = 0xFF, blue = 0x00 -> 0x00FFFF00 = Yellow
-*
-*  @param red
-*  Red component
-*  @param green
-*  Green component
-*  @param blue
-*  Blue component
-*  @return
-*  Returns a 32-bit unsigned integer representing the color. The 8 LSB is blue,
-*  the next 8 is green and the next 8 is red. 0x00RRGGBB
-*
-******************************************************************************/
-
-uint32_t GLIB_rgbColor(uint8_t red, uint8_t green, uint8_t blue)
-{
-  return (red << RedShift) | (green << GreenShift) | (blue << BlueShift);
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a pixel at x, y using foregroundColor defined in the GLIB_Context.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context which holds the foreground color
-*  @param x
-*  X-coordinate
-*  @param y
-*  Y-coordinate
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_drawPixel(const GLIB_Context *pContext,
-                        uint16_t x, uint16_t y)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  /* Draw pixel */
-  return GLIB_drawPixelColor(pContext, x, y, pContext->foregroundColor);
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a pixel at x, y with color defined by red, green and blue
-*  1 byte per channel.
-*
-*  Example: To draw a yellow pixel at (10, 10).
-*  x = 10, y = 10, red = 0xFF, green = 0xFF, blue = 0x00
-*
-*  @param x
-*  X-coordinate
-*  @param y
-*  Y-coordinate
-*  @param red
-*  8-bits red
-*  @param green
-*  8-bits green
-*  @param blue
-*  8-bits blue
-*
-*  @return
-*  Returns DMD_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_drawPixelRGB(uint16_t x, uint16_t y, uint8_t red, uint8_t green,
-                           uint8_t blue)
-{
-  /* Call Display driver function */
-  return DMD_writeColor(x, y, red, green, blue, 1);
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a pixel at x, y with color defined by the 32-bit int
-*
-*  @param x
-*  X-coordinate
-*  @param y
-*  Y-coordinate
-*  @param color
-*  32-bit int defining the RGB color. The 24 LSB defines the RGB color like this:
-*  RRRRRRRRGGGGGGGGBBBBBBBB. Example: Yellow = 0x00FFFF00
-*  @return
-*  Returns DMD_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_drawPixelColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
-                             uint32_t color)
-{
-  /* Check arguments */
-  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status;
-
-  /* Draw pixel */
-  if (GLIB_rectContainsPoint(&pContext->clippingRegion, x, y) == 1)
-  {
-    status = GLIB_resetDisplayClippingArea(pContext);
-    if (status != GLIB_OK) return status;
-
-    /* Draw pixel */
-    uint8_t red;
-    uint8_t green;
-    uint8_t blue;
-    GLIB_colorTranslate24bpp(color, &red, &green, &blue);
-    return GLIB_drawPixelRGB(x, y, red, green, blue);
-  }
-
-  return GLIB_DID_NOT_DRAW;
-}
+ /*************************************************************************//**
+ * @file glib.c
+ * @brief Energy Micro Graphics Library: General Routines
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB files */
+#include "glib.h"
+
+/* Local function prototypes */
+static void recordDirty(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height);
+static uint32_t intersectSpan(const GLIB_Rectangle *pRect, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, GLIB_Rectangle *pPart);
+static EMSTATUS writeColorRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                               uint16_t width, uint16_t height, uint32_t color);
+static EMSTATUS writeDataRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint8_t *picData);
+static EMSTATUS writeNativeRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                                uint16_t width, uint16_t height, const uint32_t *data);
+static EMSTATUS writeRGB565Rect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                                uint16_t width, uint16_t height, const uint16_t *data);
+
+/**************************************************************************//**
+*  @brief
+*  Initialize the GLIB_Context
+*
+*  The context is set to default values and gets information about the display
+*  from the display driver.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_contextInit(GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+
+  /* Make sure the native colors are computed */
+  pContext->backgroundColorNativeKey = ~Black;
+  pContext->foregroundColorNativeKey = ~White;
+
+  /* Sets the default background color */
+  GLIB_setBackgroundColor(pContext, Black);
+
+  /* Sets the default foreground color */
+  GLIB_setForegroundColor(pContext, White);
+
+  /* Draw directly to the display, without damage tracking */
+  pContext->pSurface    = NULL;
+  pContext->pDirty      = NULL;
+  pContext->pGlyphCache = NULL;
+  pContext->pClipStack  = NULL;
+
+  /* Sets a pointer to the display geometry struct */
+  DMD_DisplayGeometry *pTmpDisplayGeometry;
+  status = DMD_getDisplayGeometry(&pTmpDisplayGeometry);
+  if (status != 0) return status;
+
+  pContext->pDisplayGeometry = pTmpDisplayGeometry;
+
+  /* Sets the clipping region to the whole display */
+  GLIB_Rectangle tmpRect = { 0, 0, pTmpDisplayGeometry->xSize - 1, pTmpDisplayGeometry->ySize - 1 };
+  status = GLIB_setClippingRegion(pContext, &tmpRect);
+  if (status != 0) return status;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the display from sleep mode
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_displayWakeUp()
+{
+  /* Use display driver's wake up function */
+  return DMD_wakeUp();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the display in sleep mode
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_displaySleep()
+{
+  /* Use Display Driver sleep function */
+  return DMD_sleep();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the clippingRegion of the passed in GLIB_Context
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pRect
+*  Pointer to a GLIB_Rectangle which is the clipping region to be set.
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_INVALID_CLIPPINGREGION if invalid coordinates
+*  - Returns GLIB_OUT_OF_BOUNDS if clipping region is bigger than display clipping
+*  area
+******************************************************************************/
+
+EMSTATUS GLIB_setClippingRegion(GLIB_Context *pContext, GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pContext == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
+
+  /* Check coordinates against the display region */
+  if ((pRect->xMin >= pRect->xMax) || (pRect->yMin >= pRect->yMax)) return GLIB_INVALID_CLIPPINGREGION;
+  if (pRect->xMax > pContext->pDisplayGeometry->clipWidth) return GLIB_OUT_OF_BOUNDS;
+  if (pRect->yMax > pContext->pDisplayGeometry->clipHeight) return GLIB_OUT_OF_BOUNDS;
+
+  GLIB_Rectangle tmpRect = { pRect->xMin, pRect->yMin, pRect->xMax, pRect->yMax };
+
+  pContext->clippingRegion = tmpRect;
+
+  return GLIB_OK;
+}
+
+
+/**************************************************************************//**
+*  @brief
+*  Clears the display with the background color of the GLIB_Context
+*
+*  @param pContext
+*  Pointer to a GLIB_Context which holds the backgroundcolor.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_clear(const GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+
+  /* Clear the surface instead of the display if one is set */
+  if (pContext->pSurface != NULL)
+  {
+    const GLIB_Rectangle *pArea = &pContext->pSurface->area;
+    uint16_t areaWidth  = pArea->xMax - pArea->xMin + 1;
+    uint16_t areaHeight = pArea->yMax - pArea->yMin + 1;
+
+    /* The whole surface changes, so a dirty region must flush all of it */
+    recordDirty(pContext, pArea->xMin, pArea->yMin, areaWidth, areaHeight);
+
+    return GLIB_surfaceFill(pContext->pSurface, pArea->xMin, pArea->yMin,
+                            areaWidth, areaHeight, pContext->backgroundColor);
+  }
+
+  /* Reset display driver clipping area */
+  status = GLIB_resetDisplayClippingArea(pContext);
+  if (status != 0) return status;
+
+  uint16_t width  = pContext->pDisplayGeometry->clipWidth;
+  uint16_t height = pContext->pDisplayGeometry->clipHeight;
+  /* Fill the display with the background color of the GLIB_Context  */
+
+  status = DMD_writeColorNative(0, 0,
+                                GLIB_colorNative(pContext, pContext->backgroundColor),
+                                width * height);
+  if (status != 0) return status;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reset the display driver clipping area to the whole display
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_resetDisplayClippingArea(const GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status = DMD_setClippingArea(0, 0, pContext->pDisplayGeometry->xSize,
+                                        pContext->pDisplayGeometry->ySize);
+  if (status != DMD_OK) return status;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reset the GLIB_Context clipping region to the whole display
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_resetClippingRegion(GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle tmpRect;
+  tmpRect.xMin = pContext->pDisplayGeometry->xClipStart;
+  tmpRect.yMin = pContext->pDisplayGeometry->yClipStart;
+  tmpRect.xMax = tmpRect.xMin + pContext->pDisplayGeometry->clipWidth - 1;
+  tmpRect.yMax = tmpRect.yMin + pContext->pDisplayGeometry->clipHeight - 1;
+
+  pContext->clippingRegion = tmpRect;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Extracts the color components from the 32-bit color passed and puts them in
+*  the passed in 8-bits ints. The color is 24-bit RGB.
+*
+*  Example: color = 0x00FFFF00 -> red = 0xFF, green = 0xFF, blue = 0x00.
+*
+*  @param color
+*  The color which is to be translated
+*  @param red
+*  Pointer to a uint8_t holding the red component
+*  @param green
+*  Pointer to a uint8_t holding the green component
+*  @param blue
+*  Pointer to a uint8_t holding the blue component
+*
+*  @return
+*  None.
+******************************************************************************/
+
+void GLIB_colorTranslate24bpp(uint32_t color, uint8_t *red, uint8_t *green, uint8_t *blue)
+{
+  *red   = (color & RedMask) >> RedShift;
+  *green = (color & GreenMask) >> GreenShift;
+  *blue  = (color & BlueMask) >> BlueShift;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Convert 3 uint8_t color components into a 24-bit color
+*
+*  Example: red = 0xFF, green = 0xFF, blue = 0x00 -> 0x00FFFF00 = Yellow
+*
+*  @param red
+*  Red component
+*  @param green
+*  Green component
+*  @param blue
+*  Blue component
+*  @return
+*  Returns a 32-bit unsigned integer representing the color. The 8 LSB is blue,
+*  the next 8 is green and the next 8 is red. 0x00RRGGBB
+*
+******************************************************************************/
+
+uint32_t GLIB_rgbColor(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return (red << RedShift) | (green << GreenShift) | (blue << BlueShift);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Convert a 24-bit color into a 16-bit RGB565 color by dropping the LSBs of
+*  each component
+*
+*  Example: color = 0x00FFFF00 -> 0xFFE0
+*
+*  @param color
+*  The color which is to be translated
+*  @return
+*  Returns the RGB565 color. The 5 LSB is blue, the next 6 is green and the
+*  5 MSB is red.
+******************************************************************************/
+
+uint16_t GLIB_colorTranslateRGB565(uint32_t color)
+{
+  return ((color & RedMask) >> (RedShift + 3)) << 11 |
+         ((color & GreenMask) >> (GreenShift + 2)) << 5 |
+         ((color & BlueMask) >> (BlueShift + 3));
+}
+
+/**************************************************************************//**
+*  @brief
+*  Convert a 24-bit color into the native pixel format of the display, or
+*  into RGB565 if the GLIB_Context draws into a surface
+*
+*  The background and foreground colors of the context are converted when
+*  they are set, so drawing them directly to the display costs no conversion.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context that holds the converted colors
+*  @param color
+*  The color which is to be translated
+*  @return
+*  Returns the color in the format used by GLIB_writeDataNative()
+******************************************************************************/
+
+uint32_t GLIB_colorNative(const GLIB_Context *pContext, uint32_t color)
+{
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+
+  if (pContext->pSurface != NULL) return GLIB_colorTranslateRGB565(color);
+
+  if (color == pContext->foregroundColorNativeKey) return pContext->foregroundColorNative;
+  if (color == pContext->backgroundColorNativeKey) return pContext->backgroundColorNative;
+
+  GLIB_colorTranslate24bpp(color, &red, &green, &blue);
+  return DMD_colorNative(red, green, blue);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the foreground color of a GLIB_Context and converts it to the native
+*  pixel format of the display
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param color
+*  24-bit foreground color
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setForegroundColor(GLIB_Context *pContext, uint32_t color)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+
+  pContext->foregroundColor = color;
+
+  /* Only convert if the color changed */
+  if (color != pContext->foregroundColorNativeKey)
+  {
+    GLIB_colorTranslate24bpp(color, &red, &green, &blue);
+    pContext->foregroundColorNative    = DMD_colorNative(red, green, blue);
+    pContext->foregroundColorNativeKey = color;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the background color of a GLIB_Context and converts it to the native
+*  pixel format of the display
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param color
+*  24-bit background color
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setBackgroundColor(GLIB_Context *pContext, uint32_t color)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+
+  pContext->backgroundColor = color;
+
+  /* Only convert if the color changed */
+  if (color != pContext->backgroundColorNativeKey)
+  {
+    GLIB_colorTranslate24bpp(color, &red, &green, &blue);
+    pContext->backgroundColorNative    = DMD_colorNative(red, green, blue);
+    pContext->backgroundColorNativeKey = color;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a pixel at x, y using foregroundColor defined in the GLIB_Context.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context which holds the foreground color
+*  @param x
+*  X-coordinate
+*  @param y
+*  Y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawPixel(const GLIB_Context *pContext,
+                        uint16_t x, uint16_t y)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  /* Draw pixel */
+  return GLIB_drawPixelColor(pContext, x, y, pContext->foregroundColor);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a pixel at x, y with color defined by red, green and blue
+*  1 byte per channel.
+*
+*  Example: To draw a yellow pixel at (10, 10).
+*  x = 10, y = 10, red = 0xFF, green = 0xFF, blue = 0x00
+*
+*  @param x
+*  X-coordinate
+*  @param y
+*  Y-coordinate
+*  @param red
+*  8-bits red
+*  @param green
+*  8-bits green
+*  @param blue
+*  8-bits blue
+*
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawPixelRGB(uint16_t x, uint16_t y, uint8_t red, uint8_t green,
+                           uint8_t blue)
+{
+  /* Call Display driver function */
+  return DMD_writeColor(x, y, red, green, blue, 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a pixel at x, y with color defined by the 32-bit int
+*
+*  @param x
+*  X-coordinate
+*  @param y
+*  Y-coordinate
+*  @param color
+*  32-bit int defining the RGB color. The 24 LSB defines the RGB color like this:
+*  RRRRRRRRGGGGGGGGBBBBBBBB. Example: Yellow = 0x00FFFF00
+*  @return
+*  Returns DMD_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawPixelColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                             uint32_t color)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  /* Draw pixel */
+  if (GLIB_rectContainsPoint(&pContext->clippingRegion, x, y) == 1)
+  {
+    return GLIB_writeColor(pContext, x, y, 1, 1, color);
+  }
+
+  return GLIB_DID_NOT_DRAW;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills a rectangle with one color, either on the display or in the surface
+*  of the GLIB_Context. The rectangle is not clipped against the clipping
+*  region of the context, but only the parts inside the clip region pushed
+*  with GLIB_pushClipRegion() or GLIB_pushClipExclude() are filled.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param color
+*  32-bit int defining the RGB color. The 24 LSB defines the RGB color like this:
+*  RRRRRRRRGGGGGGGGBBBBBBBB.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_writeColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                         uint16_t width, uint16_t height, uint32_t color)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS             status;
+  const GLIB_Rectangle *pRects;
+  GLIB_Rectangle       part;
+  uint32_t             numRects, i;
+
+  pRects = GLIB_getClipRects(pContext, &numRects);
+  if (pRects == NULL) return writeColorRect(pContext, x, y, width, height, color);
+
+  /* Fill the part inside each rectangle of the clip region */
+  for (i = 0; i < numRects; i++)
+  {
+    if (!intersectSpan(&pRects[i], x, y, width, height, &part)) continue;
+
+    status = writeColorRect(pContext, part.xMin, part.yMin, part.xMax - part.xMin + 1,
+                            part.yMax - part.yMin + 1, color);
+    if (status != GLIB_OK) return status;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills a rectangle with one color, without looking at the clip region
+******************************************************************************/
+static EMSTATUS writeColorRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                               uint16_t width, uint16_t height, uint32_t color)
+{
+  recordDirty(pContext, x, y, width, height);
+
+  if (pContext->pSurface != NULL)
+  {
+    return GLIB_surfaceFill(pContext->pSurface, x, y, width, height, color);
+  }
+
+  EMSTATUS status;
+
+  status = DMD_setClippingArea(x, y, width, height);
+  if (status != DMD_OK) return status;
+
+  status = DMD_writeColorNative(0, 0, GLIB_colorNative(pContext, color),
+                                (uint32_t) width * height);
+  if (status != DMD_OK) return status;
+
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of 24-bit RGB pixels, either to the display or to the
+*  surface of the GLIB_Context. The rectangle is not clipped against the
+*  clipping region of the context, but only the parts inside a pushed clip
+*  region are written.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param picData
+*  Pixel data, organized as { R, G, B, R, G, B ... }
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_writeData(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height, const uint8_t *picData)
+{
+  /* Check arguments */
+  if (pContext == NULL || picData == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS             status;
+  const GLIB_Rectangle *pRects;
+  GLIB_Rectangle       part;
+  uint32_t             numRects, i;
+  uint16_t             partWidth, row;
+
+  pRects = GLIB_getClipRects(pContext, &numRects);
+  if (pRects == NULL) return writeDataRect(pContext, x, y, width, height, picData);
+
+  /* Write the part inside each rectangle of the clip region. The rows of a
+   * part are only contiguous in picData if it is as wide as the rectangle. */
+  for (i = 0; i < numRects; i++)
+  {
+    if (!intersectSpan(&pRects[i], x, y, width, height, &part)) continue;
+
+    partWidth = part.xMax - part.xMin + 1;
+    for (row = part.yMin; row <= part.yMax; row++)
+    {
+      status = writeDataRect(pContext, part.xMin, row, partWidth,
+                             (partWidth == width) ? part.yMax - row + 1 : 1,
+                             picData + 3 * ((uint32_t) (row - y) * width + (part.xMin - x)));
+      if (status != GLIB_OK) return status;
+      if (partWidth == width) break;
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of 24-bit RGB pixels, without looking at the clip
+*  region
+******************************************************************************/
+static EMSTATUS writeDataRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint8_t *picData)
+{
+  recordDirty(pContext, x, y, width, height);
+
+  if (pContext->pSurface != NULL)
+  {
+    return GLIB_surfaceWrite(pContext->pSurface, x, y, width, height, picData);
+  }
+
+  EMSTATUS status;
+
+  status = DMD_setClippingArea(x, y, width, height);
+  if (status != DMD_OK) return status;
+
+  status = DMD_writeData(0, 0, picData, (uint32_t) width * height);
+  if (status != DMD_OK) return status;
+
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of pixels that are already converted with
+*  GLIB_colorNative(), either to the display or to the surface of the
+*  GLIB_Context. The rectangle is not clipped against the clipping region of
+*  the context, but only the parts inside a pushed clip region are written.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param data
+*  Pixel data, row by row
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_writeDataNative(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint32_t *data)
+{
+  /* Check arguments */
+  if (pContext == NULL || data == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS             status;
+  const GLIB_Rectangle *pRects;
+  GLIB_Rectangle       part;
+  uint32_t             numRects, i;
+  uint16_t             partWidth, row;
+
+  pRects = GLIB_getClipRects(pContext, &numRects);
+  if (pRects == NULL) return writeNativeRect(pContext, x, y, width, height, data);
+
+  /* Write the part inside each rectangle of the clip region, row by row
+   * unless the part is as wide as the rectangle */
+  for (i = 0; i < numRects; i++)
+  {
+    if (!intersectSpan(&pRects[i], x, y, width, height, &part)) continue;
+
+    partWidth = part.xMax - part.xMin + 1;
+    for (row = part.yMin; row <= part.yMax; row++)
+    {
+      status = writeNativeRect(pContext, part.xMin, row, partWidth,
+                               (partWidth == width) ? part.yMax - row + 1 : 1,
+                               data + (uint32_t) (row - y) * width + (part.xMin - x));
+      if (status != GLIB_OK) return status;
+      if (partWidth == width) break;
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of native pixels, without looking at the clip region
+******************************************************************************/
+static EMSTATUS writeNativeRect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                                uint16_t width, uint16_t height, const uint32_t *data)
+{
+  recordDirty(pContext, x, y, width, height);
+
+  if (pContext->pSurface != NULL)
+  {
+    return GLIB_surfaceWriteNative(pContext->pSurface, x, y, width, height, data);
+  }
+
+  EMSTATUS status;
+
+  status = DMD_setClippingArea(x, y, width, height);
+  if (status != DMD_OK) return status;
+
+  status = DMD_writeDataNative(0, 0, data, (uint32_t) width * height);
+  if (status != DMD_OK) return status;
+
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of packed RGB565 pixels, either to the display or to
+*  the surface of the GLIB_Context. The rectangle is not clipped against the
+*  clipping region of the context, but only the parts inside a pushed clip
+*  region are written.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param data
+*  Pixel data, row by row
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_writeDataRGB565(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint16_t *data)
+{
+  /* Check arguments */
+  if (pContext == NULL || data == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS             status;
+  const GLIB_Rectangle *pRects;
+  GLIB_Rectangle       part;
+  uint32_t             numRects, i;
+  uint16_t             partWidth, row;
+
+  pRects = GLIB_getClipRects(pContext, &numRects);
+  if (pRects == NULL) return writeRGB565Rect(pContext, x, y, width, height, data);
+
+  /* Write the part inside each rectangle of the clip region, row by row
+   * unless the part is as wide as the rectangle */
+  for (i = 0; i < numRects; i++)
+  {
+    if (!intersectSpan(&pRects[i], x, y, width, height, &part)) continue;
+
+    partWidth = part.xMax - part.xMin + 1;
+    for (row = part.yMin; row <= part.yMax; row++)
+    {
+      status = writeRGB565Rect(pContext, part.xMin, row, partWidth,
+                               (partWidth == width) ? part.yMax - row + 1 : 1,
+                               data + (uint32_t) (row - y) * width + (part.xMin - x));
+      if (status != GLIB_OK) return status;
+      if (partWidth == width) break;
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of RGB565 pixels, without looking at the clip region
+******************************************************************************/
+static EMSTATUS writeRGB565Rect(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                                uint16_t width, uint16_t height, const uint16_t *data)
+{
+  recordDirty(pContext, x, y, width, height);
+
+  if (pContext->pSurface != NULL)
+  {
+    return GLIB_surfaceWriteRGB565(pContext->pSurface, x, y, width, height, data);
+  }
+
+  EMSTATUS status;
+
+  status = DMD_setClippingArea(x, y, width, height);
+  if (status != DMD_OK) return status;
+
+  status = DMD_writeDataRGB565(0, 0, data, (uint32_t) width * height);
+  if (status != DMD_OK) return status;
+
+  return GLIB_resetDisplayClippingArea(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a rectangle that is about to be drawn to the dirty region of the
+*  GLIB_Context, if it has one
+******************************************************************************/
+static void recordDirty(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height)
+{
+  if (pContext->pDirty == NULL || width == 0 || height == 0) return;
+
+  uint32_t xMax = (uint32_t) x + width - 1;
+  uint32_t yMax = (uint32_t) y + height - 1;
+
+  GLIB_Rectangle rect;
+  rect.xMin = x;
+  rect.yMin = y;
+  rect.xMax = (xMax > 0xFFFF) ? 0xFFFF : xMax;
+  rect.yMax = (yMax > 0xFFFF) ? 0xFFFF : yMax;
+
+  GLIB_dirtyAdd(pContext->pDirty, &rect);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Intersects a rectangle given by position and size with a rectangle of
+*  the clip region
+*
+*  @return
+*  Returns 1 if the intersection is not empty, otherwise 0
+******************************************************************************/
+static uint32_t intersectSpan(const GLIB_Rectangle *pRect, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, GLIB_Rectangle *pPart)
+{
+  int32_t xMax = (int32_t) x + width - 1;
+  int32_t yMax = (int32_t) y + height - 1;
+
+  if (width == 0 || height == 0) return 0;
+
+  if (x > pRect->xMax || y > pRect->yMax) return 0;
+  if (xMax < pRect->xMin || yMax < pRect->yMin) return 0;
+
+  pPart->xMin = (x < pRect->xMin) ? pRect->xMin : x;
+  pPart->yMin = (y < pRect->yMin) ? pRect->yMin : y;
+  pPart->xMax = (xMax > pRect->xMax) ? pRect->xMax : xMax;
+  pPart->yMax = (yMax > pRect->yMax) ? pRect->yMax : yMax;
+
+  return 1;
+}
@@ -1,173 +1,767 @@
- /*************************************************************************//**
- * @file glib.h
- * @brief Energy Micro Graphics Library
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-#ifndef __GLIB_H
-#define __GLIB_H
-
-/* C-header files */
-#include <stdint.h>
-#include <stdlib.h>
-
-/* GLIB header files */
-#include "glib_color.h"
-
-/* Display Driver header files */
-#include "dmd/ssd2119/dmd_ssd2119.h"
-
-#include "em_types.h"
-
-#define ECODE_GLIB_BASE    0x00000000
-
-/* Error codes */
-/** Successful call */
-#define GLIB_OK                        0x00000000
-/** Function did not draw */
-#define GLIB_DID_NOT_DRAW              (ECODE_GLIB_BASE | 0x0001)
-/** Invalid char */
-#define GLIB_INVALID_CHAR              (ECODE_GLIB_BASE | 0x0002)
-/** Coordinates out of bounds */
-#define GLIB_OUT_OF_BOUNDS             (ECODE_GLIB_BASE | 0x0003)
-/** Invalid coordinates (ex. xMin > xMax) */
-#define GLIB_INVALID_CLIPPINGREGION    (ECODE_GLIB_BASE | 0x0004)
-/** Invalid argument */
-#define GLIB_INVALID_ARGUMENT          (ECODE_GLIB_BASE | 0x0005)
-/** Out of memory */
-#define GLIB_OUT_OF_MEMORY             (ECODE_GLIB_BASE | 0x0006)
-/** File not supported */
-#define GLIB_FILE_NOT_SUPPORTED        (ECODE_GLIB_BASE | 0x0007)
-/** General IO Error */
-#define GLIB_IO_ERROR                  (ECODE_GLIB_BASE | 0x0008)
-/** Invalid file */
-#define GLIB_INVALID_FILE              (ECODE_GLIB_BASE | 0x0009)
-
-/** @struct __GLIB_Rectangle
- *  @brief Rectangle structure
- */
-typedef struct __GLIB_Rectangle
-{
-  /** Minimum x-coordinate */
-  uint16_t xMin;
-  /** Minimum y-coordinate */
-  uint16_t yMin;
-  /** Maximum x-coordinate */
-  uint16_t xMax;
-  /** Maximum y-coordinate */
-  uint16_t yMax;
-} GLIB_Rectangle;
-
-/** @struct __GLIB_Context
- *  @brief GLIB Drawing Context
- *  (Multiple instances of GLIB_Context can exist)
- */
-typedef struct __GLIB_Context
-{
-  /** Pointer to the dimensions of the display */
-  const DMD_DisplayGeometry *pDisplayGeometry;
-
-  /** Background color */
-  uint32_t                  backgroundColor;
-
-  /** Foreground color */
-  uint32_t                  foregroundColor;
-
-  /** Clipping rectangle */
-  GLIB_Rectangle            clippingRegion;
-} GLIB_Context;
-
-/* Prototypes for graphics library functions */
-EMSTATUS GLIB_contextInit(GLIB_Context *pContext);
-
-EMSTATUS GLIB_displayWakeUp(void);
-
-EMSTATUS GLIB_displaySleep(void);
-
-EMSTATUS GLIB_clear(const GLIB_Context *pContext);
-
-EMSTATUS GLIB_resetDisplayClippingArea(const GLIB_Context *pContext);
-
-EMSTATUS GLIB_resetClippingRegion(GLIB_Context *pContext);
-
-void GLIB_colorTranslate24bpp(uint32_t color, uint8_t *red, uint8_t *green, uint8_t *blue);
-
-uint32_t GLIB_rgbColor(uint8_t red, uint8_t green, uint8_t blue);
-
-uint32_t GLIB_rectContainsPoint(const GLIB_Rectangle *pRect, uint16_t xCenter, uint16_t yCenter);
-
-void GLIB_normalizeRect(GLIB_Rectangle *pRect);
-
-EMSTATUS GLIB_setClippingRegion(GLIB_Context *pContext, GLIB_Rectangle *pRect);
-
-EMSTATUS GLIB_drawCircle(const GLIB_Context *pContext, uint16_t x, uint16_t y,
-                         uint16_t radius);
-
-EMSTATUS GLIB_drawCircleFilled(const GLIB_Context *pContext, uint16_t x, uint16_t y,
-                               uint16_t radius);
-
-EMSTATUS GLIB_drawPartialCircle(const GLIB_Context *pContext, uint16_t xCenter,
-                                uint16_t yCenter, uint16_t radius, uint8_t bitMask);
-
-EMSTATUS GLIB_drawString(const GLIB_Context *pContext, char* pString, uint16_t sLength,
-                         uint16_t x0, uint16_t y0, uint32_t opaque);
-
-EMSTATUS GLIB_drawChar(const GLIB_Context *pContext, char myChar, uint16_t x,
-                       uint16_t y, uint32_t opaque);
-
-EMSTATUS GLIB_drawBitmap(const GLIB_Context* pContext, uint16_t x, uint16_t y,
-                         uint16_t width, uint16_t height, uint8_t *picData);
-
-EMSTATUS GLIB_drawLine(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                       uint16_t x2, uint16_t y2);
-
-EMSTATUS GLIB_drawLineH(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                        uint16_t x2);
-
-EMSTATUS GLIB_drawLineV(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                        uint16_t y2);
-
-EMSTATUS GLIB_drawRect(const GLIB_Context *pContext, GLIB_Rectangle *pRect);
-
-EMSTATUS GLIB_drawRectFilled(const GLIB_Context *pContext,
-                             GLIB_Rectangle *pRect);
-
-EMSTATUS GLIB_drawPolygon(const GLIB_Context *pContext,
-                          uint32_t numPoints, uint16_t *polyPoints);
-
-EMSTATUS GLIB_drawPixelRGB(uint16_t x, uint16_t y,
-                           uint8_t red, uint8_t green, uint8_t blue);
-
-EMSTATUS GLIB_drawPixel(const GLIB_Context *pContext, uint16_t x, uint16_t y);
-
-EMSTATUS GLIB_drawPixelColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
-                             uint32_t color);
-#endif
+ /*************************************************************************//**
+ * @file glib.h
+ * @brief Energy Micro Graphics Library
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+#ifndef __GLIB_H
+#define __GLIB_H
+
+/* C-header files */
+#include <stdint.h>
+#include <stdlib.h>
+
+/* GLIB header files */
+#include "glib_color.h"
+
+/* Display Driver header files */
+#include "dmd/ssd2119/dmd_ssd2119.h"
+
+#include "em_types.h"
+
+#define ECODE_GLIB_BASE    0x00000000
+
+/* Error codes */
+/** Successful call */
+#define GLIB_OK                        0x00000000
+/** Function did not draw */
+#define GLIB_DID_NOT_DRAW              (ECODE_GLIB_BASE | 0x0001)
+/** Invalid char */
+#define GLIB_INVALID_CHAR              (ECODE_GLIB_BASE | 0x0002)
+/** Coordinates out of bounds */
+#define GLIB_OUT_OF_BOUNDS             (ECODE_GLIB_BASE | 0x0003)
+/** Invalid coordinates (ex. xMin > xMax) */
+#define GLIB_INVALID_CLIPPINGREGION    (ECODE_GLIB_BASE | 0x0004)
+/** Invalid argument */
+#define GLIB_INVALID_ARGUMENT          (ECODE_GLIB_BASE | 0x0005)
+/** Out of memory */
+#define GLIB_OUT_OF_MEMORY             (ECODE_GLIB_BASE | 0x0006)
+/** File not supported */
+#define GLIB_FILE_NOT_SUPPORTED        (ECODE_GLIB_BASE | 0x0007)
+/** General IO Error */
+#define GLIB_IO_ERROR                  (ECODE_GLIB_BASE | 0x0008)
+/** Invalid file */
+#define GLIB_INVALID_FILE              (ECODE_GLIB_BASE | 0x0009)
+
+/** @struct __GLIB_Rectangle
+ *  @brief Rectangle structure
+ */
+typedef struct __GLIB_Rectangle
+{
+  /** Minimum x-coordinate */
+  uint16_t xMin;
+  /** Minimum y-coordinate */
+  uint16_t yMin;
+  /** Maximum x-coordinate */
+  uint16_t xMax;
+  /** Maximum y-coordinate */
+  uint16_t yMax;
+} GLIB_Rectangle;
+
+/** @struct __GLIB_Surface
+ *  @brief Off-screen render target. The surface covers a rectangle of the
+ *  display and keeps one RGB565 pixel per display pixel in RAM.
+ */
+typedef struct __GLIB_Surface
+{
+  /** Pixel buffer, one RGB565 value per pixel */
+  uint16_t                  *pixels;
+
+  /** Number of pixels from the start of one row to the start of the next */
+  uint16_t                  stride;
+
+  /** Display area covered by the surface */
+  GLIB_Rectangle            area;
+} GLIB_Surface;
+
+/** Maximum number of rectangles kept by a GLIB_DirtyRegion */
+#ifndef GLIB_DIRTY_MAX_RECTS
+#define GLIB_DIRTY_MAX_RECTS           8
+#endif
+
+/* A full dirty region makes room by merging two of its rectangles */
+#if GLIB_DIRTY_MAX_RECTS < 2
+#error "GLIB_DIRTY_MAX_RECTS must be at least 2"
+#endif
+
+/** Number of wasted pixels that merging two dirty rectangles may cost. A
+ *  separate rectangle costs a window and address setup when it is flushed,
+ *  so rectangles are merged when that costs less than pushing this many
+ *  pixels that did not change. */
+#ifndef GLIB_DIRTY_MERGE_COST
+#define GLIB_DIRTY_MERGE_COST          64
+#endif
+
+/** @struct __GLIB_DirtyRegion
+ *  @brief Set of display rectangles that have changed since the last flush
+ */
+typedef struct __GLIB_DirtyRegion
+{
+  /** Dirty rectangles */
+  GLIB_Rectangle            rects[GLIB_DIRTY_MAX_RECTS];
+
+  /** Number of rectangles in use */
+  uint32_t                  numRects;
+} GLIB_DirtyRegion;
+
+/** Maximum number of rectangles of all clip regions on a GLIB_ClipStack */
+#ifndef GLIB_CLIP_MAX_RECTS
+#define GLIB_CLIP_MAX_RECTS            16
+#endif
+
+/** Maximum number of clip regions that can be pushed on a GLIB_ClipStack */
+#ifndef GLIB_CLIP_STACK_DEPTH
+#define GLIB_CLIP_STACK_DEPTH          4
+#endif
+
+/** @struct __GLIB_ClipLevel
+ *  @brief One pushed clip region of a GLIB_ClipStack
+ */
+typedef struct __GLIB_ClipLevel
+{
+  /** Clipping region of the context before the push, restored by the pop */
+  GLIB_Rectangle            savedClip;
+
+  /** Index of the first rectangle of the region in the stack */
+  uint16_t                  firstRect;
+
+  /** Number of rectangles of the region */
+  uint16_t                  numRects;
+
+  /** 1 if the rectangles limit drawing, 0 if the clipping region of the
+   *  context is the whole region */
+  uint16_t                  hasRegion;
+} GLIB_ClipLevel;
+
+/** @struct __GLIB_ClipStack
+ *  @brief Stack of clip regions made of disjoint rectangles. The regions
+ *  share one array of rectangles, each stored after the one below it.
+ */
+typedef struct __GLIB_ClipStack
+{
+  /** Pushed regions. Level 0 is the bottom, where no region is pushed. */
+  GLIB_ClipLevel            levels[GLIB_CLIP_STACK_DEPTH + 1];
+
+  /** Number of pushed regions */
+  uint32_t                  depth;
+
+  /** Rectangles of all pushed regions */
+  GLIB_Rectangle            rects[GLIB_CLIP_MAX_RECTS];
+} GLIB_ClipStack;
+
+/** Results of GLIB_regionContainsRect() */
+#define GLIB_REGION_OUT                0
+#define GLIB_REGION_PART               1
+#define GLIB_REGION_IN                 2
+
+/** @struct __GLIB_Region
+ *  @brief Set of pixels stored as disjoint rectangles, in rectangle storage
+ *  supplied by the application. The rectangles are grouped in bands of equal
+ *  yMin and yMax, sorted from top to bottom. Within a band they are sorted
+ *  from left to right and do not touch. Bands that touch vertically never
+ *  have the same rectangles, so every set of pixels is stored one way only.
+ */
+typedef struct __GLIB_Region
+{
+  /** Rectangle storage */
+  GLIB_Rectangle            *rects;
+
+  /** Number of rectangles the storage holds */
+  uint32_t                  maxRects;
+
+  /** Number of rectangles in use */
+  uint32_t                  numRects;
+
+  /** Bounding box of the rectangles, only valid if numRects is not 0 */
+  GLIB_Rectangle            extents;
+} GLIB_Region;
+
+/** @struct __GLIB_Glyph
+ *  @brief Bitmap position and metrics of one character of a GLIB_Font
+ */
+typedef struct __GLIB_Glyph
+{
+  /** Offset of the packed bitmap in the glyph data of the font */
+  uint32_t                  offset;
+
+  /** Width and height of the bitmap */
+  uint8_t                   width;
+  uint8_t                   height;
+
+  /** Position of the bitmap relative to the upper left corner of the
+   *  character cell */
+  int8_t                    xOffset;
+  int8_t                    yOffset;
+
+  /** Horizontal distance from this character to the next one */
+  uint8_t                   advance;
+} GLIB_Glyph;
+
+/** @struct __GLIB_KerningPair
+ *  @brief Spacing adjustment between two characters of a GLIB_Font
+ */
+typedef struct __GLIB_KerningPair
+{
+  /** Left and right character */
+  uint8_t                   left;
+  uint8_t                   right;
+
+  /** Number of pixels to add to the advance of the left character */
+  int8_t                    adjust;
+} GLIB_KerningPair;
+
+/** @struct __GLIB_Font
+ *  @brief Proportional font with run-length packed glyphs
+ *
+ *  With 1 bit per pixel, the bitmap of a glyph is scanned row by row and
+ *  stored as the lengths of alternating runs of clear and set pixels, one
+ *  byte per run, starting with a clear run. Runs continue across rows. A run
+ *  longer than 255 pixels is split by a zero length run of the other kind.
+ *
+ *  With 4 bits per pixel, each pixel is a coverage value from 0 (background)
+ *  to 15 (foreground). Every row starts on a new byte, and the leftmost
+ *  pixel of a byte is in the low nibble.
+ */
+typedef struct __GLIB_Font
+{
+  /** Glyph table, indexed by character code minus firstChar */
+  const GLIB_Glyph          *pGlyphs;
+
+  /** Packed bitmaps of all glyphs */
+  const uint8_t             *pData;
+
+  /** Kerning pairs, sorted by left and then right character, or NULL */
+  const GLIB_KerningPair    *pKerning;
+
+  /** Number of kerning pairs */
+  uint16_t                  numKerningPairs;
+
+  /** First and last character in the glyph table */
+  uint8_t                   firstChar;
+  uint8_t                   lastChar;
+
+  /** Height of a character cell */
+  uint8_t                   height;
+
+  /** Number of pixels between two lines of text */
+  uint8_t                   lineSpacing;
+
+  /** 1 for run-length packed glyphs, 4 for anti-aliased glyphs. 0 is
+   *  treated as 1. */
+  uint8_t                   bitsPerPixel;
+} GLIB_Font;
+
+/** Number of entries in a GLIB_BlendRamp */
+#define GLIB_BLEND_RAMP_SIZE           16
+
+/** @struct __GLIB_BlendRamp
+ *  @brief Colors between a background and a foreground color, converted
+ *  for the target, used to draw anti-aliased glyphs
+ */
+typedef struct __GLIB_BlendRamp
+{
+  /** Colors the ramp was computed for */
+  uint32_t                  foregroundColor;
+  uint32_t                  backgroundColor;
+
+  /** Value of the use counter of the glyph cache when the ramp was last used */
+  uint32_t                  lastUse;
+
+  /** 1 if the colors are RGB565 for a surface, 0 if native display pixels */
+  uint16_t                  surfaceFormat;
+
+  /** 1 if the ramp holds colors */
+  uint16_t                  valid;
+
+  /** Color for each coverage value, from background to foreground */
+  uint32_t                  colors[GLIB_BLEND_RAMP_SIZE];
+} GLIB_BlendRamp;
+
+/** @struct __GLIB_TextLine
+ *  @brief One line of a GLIB_TextLayout
+ */
+typedef struct __GLIB_TextLine
+{
+  /** Index of the first char of the line in the string */
+  uint16_t                  start;
+
+  /** Number of chars on the line, without the newline or the spaces at
+   *  which the line was wrapped */
+  uint16_t                  length;
+
+  /** Width of the line in pixels */
+  uint16_t                  width;
+} GLIB_TextLine;
+
+/** @struct __GLIB_TextLayout
+ *  @brief Line breaks of a string wrapped inside a rectangle. The layout
+ *  stays valid, and can be drawn any number of times, until the string or
+ *  the rectangle changes.
+ */
+typedef struct __GLIB_TextLayout
+{
+  /** Font of the layout, NULL for the font supplied with the library */
+  const GLIB_Font           *pFont;
+
+  /** String of the layout. It is not copied. */
+  const char                *pString;
+
+  /** Rectangle the string is wrapped inside */
+  GLIB_Rectangle            box;
+
+  /** Buffer of lines, given to GLIB_textLayoutInit() */
+  GLIB_TextLine             *pLines;
+  uint16_t                  maxLines;
+
+  /** Number of lines in use */
+  uint16_t                  numLines;
+
+  /** Vertical distance from one line to the next */
+  uint16_t                  lineHeight;
+
+  /** Index of the first char that did not fit in the rectangle, or the
+   *  length of the string if all chars fit */
+  uint16_t                  end;
+} GLIB_TextLayout;
+
+/** Largest number of points of a polygon filled by GLIB_drawPolygonFilled() */
+#ifndef GLIB_POLYGON_MAX_EDGES
+#define GLIB_POLYGON_MAX_EDGES         32
+#endif
+
+/** Fill rules of GLIB_drawPolygonFilled(). With even-odd, a pixel is
+ *  inside if a ray from it crosses the outline an odd number of times. With
+ *  non-zero, it is inside if the outline winds around it at least once. */
+#define GLIB_FILL_EVEN_ODD             0
+#define GLIB_FILL_NON_ZERO             1
+
+/** Number of blend ramps kept by a GLIB_GlyphCache */
+#ifndef GLIB_GLYPH_CACHE_RAMPS
+#define GLIB_GLYPH_CACHE_RAMPS         4
+#endif
+
+/** Largest glyph box, in pixels, that a GLIB_GlyphCache can hold. Glyphs
+ *  of the built-in font are 8x8 pixels, larger fonts need a larger value. */
+#ifndef GLIB_GLYPH_CACHE_MAX_PIXELS
+#define GLIB_GLYPH_CACHE_MAX_PIXELS    64
+#endif
+
+/** @struct __GLIB_GlyphCacheEntry
+ *  @brief A glyph rendered in one color pair as packed RGB565 pixels
+ */
+typedef struct __GLIB_GlyphCacheEntry
+{
+  /** Font the glyph belongs to, NULL if the entry is unused */
+  const void                *pFont;
+
+  /** Foreground and background color the glyph was rendered with */
+  uint32_t                  foregroundColor;
+  uint32_t                  backgroundColor;
+
+  /** Character code of the glyph */
+  uint16_t                  glyph;
+
+  /** Rendered pixels of the glyph box, row by row */
+  uint16_t                  pixels[GLIB_GLYPH_CACHE_MAX_PIXELS];
+} GLIB_GlyphCacheEntry;
+
+/** @struct __GLIB_GlyphCache
+ *  @brief Direct-mapped cache of rendered glyphs. Each glyph and color pair
+ *  has one entry it can be stored in, replacing the glyph that was there.
+ *  The entries are stored in a buffer supplied by the application.
+ */
+typedef struct __GLIB_GlyphCache
+{
+  /** Cache entries */
+  GLIB_GlyphCacheEntry      *entries;
+
+  /** Number of entries that fit in the buffer */
+  uint32_t                  numEntries;
+
+  /** Incremented on every ramp lookup, used to find the least recently used
+   *  ramp */
+  uint32_t                  useCounter;
+
+  /** Number of lookups that found the glyph */
+  uint32_t                  hits;
+
+  /** Number of lookups that did not find the glyph */
+  uint32_t                  misses;
+
+  /** Blend ramps of the most recently used color pairs */
+  GLIB_BlendRamp            ramps[GLIB_GLYPH_CACHE_RAMPS];
+} GLIB_GlyphCache;
+
+/** @struct __GLIB_Context
+ *  @brief GLIB Drawing Context
+ *  (Multiple instances of GLIB_Context can exist)
+ */
+typedef struct __GLIB_Context
+{
+  /** Pointer to the dimensions of the display */
+  const DMD_DisplayGeometry *pDisplayGeometry;
+
+  /** Background color */
+  uint32_t                  backgroundColor;
+
+  /** Foreground color */
+  uint32_t                  foregroundColor;
+
+  /** Background and foreground colors in the native pixel format of the
+   *  display, set by GLIB_setBackgroundColor() and GLIB_setForegroundColor().
+   *  Each is only used while the 24-bit color it was converted from is drawn,
+   *  so colors that are assigned directly still draw correctly. */
+  uint32_t                  backgroundColorNative;
+  uint32_t                  backgroundColorNativeKey;
+  uint32_t                  foregroundColorNative;
+  uint32_t                  foregroundColorNativeKey;
+
+  /** Clipping rectangle */
+  GLIB_Rectangle            clippingRegion;
+
+  /** Surface to draw into, or NULL to draw directly to the display */
+  GLIB_Surface              *pSurface;
+
+  /** Region that records what is drawn, or NULL to not track damage */
+  GLIB_DirtyRegion          *pDirty;
+
+  /** Cache of rendered glyphs, or NULL to render every glyph from the font */
+  GLIB_GlyphCache           *pGlyphCache;
+
+  /** Stack of clip regions, or NULL to clip to clippingRegion only */
+  GLIB_ClipStack            *pClipStack;
+} GLIB_Context;
+
+/** @struct __GLIB_DisplayList
+ *  @brief Recorded draw calls that can be replayed later. The commands are
+ *  stored in a buffer supplied by the application.
+ */
+typedef struct __GLIB_DisplayList
+{
+  /** Command buffer */
+  uint16_t                  *buffer;
+
+  /** Size of the buffer in 16-bit words */
+  uint32_t                  size;
+
+  /** Number of words in use by commands */
+  uint32_t                  used;
+
+  /** Number of draw commands, each with a two-word entry in the replay
+   *  order at the end of the buffer */
+  uint32_t                  numCommands;
+
+  /** Position of the last state command */
+  uint32_t                  statePos;
+
+  /** Colors and clipping region of the last recorded command */
+  uint32_t                  foregroundColor;
+  uint32_t                  backgroundColor;
+  GLIB_Rectangle            clippingRegion;
+  uint32_t                  stateValid;
+} GLIB_DisplayList;
+
+/** Callback that draws a whole frame into a GLIB_Context. Used by
+ *  GLIB_renderBands(), which calls it once per band. */
+typedef EMSTATUS (*GLIB_DrawFunction)(GLIB_Context *pContext, void *pUser);
+
+/* Prototypes for graphics library functions */
+EMSTATUS GLIB_contextInit(GLIB_Context *pContext);
+
+EMSTATUS GLIB_displayWakeUp(void);
+
+EMSTATUS GLIB_displaySleep(void);
+
+EMSTATUS GLIB_clear(const GLIB_Context *pContext);
+
+EMSTATUS GLIB_resetDisplayClippingArea(const GLIB_Context *pContext);
+
+EMSTATUS GLIB_resetClippingRegion(GLIB_Context *pContext);
+
+void GLIB_colorTranslate24bpp(uint32_t color, uint8_t *red, uint8_t *green, uint8_t *blue);
+
+uint32_t GLIB_rgbColor(uint8_t red, uint8_t green, uint8_t blue);
+
+uint16_t GLIB_colorTranslateRGB565(uint32_t color);
+
+uint32_t GLIB_colorNative(const GLIB_Context *pContext, uint32_t color);
+
+EMSTATUS GLIB_setForegroundColor(GLIB_Context *pContext, uint32_t color);
+
+EMSTATUS GLIB_setBackgroundColor(GLIB_Context *pContext, uint32_t color);
+
+uint32_t GLIB_rectContainsPoint(const GLIB_Rectangle *pRect, uint16_t xCenter, uint16_t yCenter);
+
+void GLIB_normalizeRect(GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_setClippingRegion(GLIB_Context *pContext, GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_drawCircle(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                         uint16_t radius);
+
+EMSTATUS GLIB_drawCircleFilled(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                               uint16_t radius);
+
+EMSTATUS GLIB_drawPartialCircle(const GLIB_Context *pContext, uint16_t xCenter,
+                                uint16_t yCenter, uint16_t radius, uint8_t bitMask);
+
+EMSTATUS GLIB_drawArc(const GLIB_Context *pContext, uint16_t xCenter, uint16_t yCenter,
+                      uint16_t radius, uint16_t startAngle, uint16_t endAngle);
+
+EMSTATUS GLIB_drawString(const GLIB_Context *pContext, char* pString, uint16_t sLength,
+                         uint16_t x0, uint16_t y0, uint32_t opaque);
+
+EMSTATUS GLIB_drawChar(const GLIB_Context *pContext, char myChar, uint16_t x,
+                       uint16_t y, uint32_t opaque);
+
+const GLIB_Glyph *GLIB_fontGlyph(const GLIB_Font *pFont, char myChar);
+
+int32_t GLIB_fontKerning(const GLIB_Font *pFont, char left, char right);
+
+EMSTATUS GLIB_blendRampInit(GLIB_BlendRamp *pRamp, const GLIB_Context *pContext);
+
+EMSTATUS GLIB_drawCharFont(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                           char myChar, uint16_t x, uint16_t y, uint32_t opaque);
+
+EMSTATUS GLIB_drawStringFont(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                             const char *pString, uint16_t sLength,
+                             uint16_t x0, uint16_t y0, uint32_t opaque);
+
+EMSTATUS GLIB_measureString(const GLIB_Font *pFont, const char *pString, uint16_t sLength,
+                            uint16_t *pWidth, uint16_t *pHeight);
+
+EMSTATUS GLIB_textLayoutInit(GLIB_TextLayout *pLayout, GLIB_TextLine *pLines,
+                             uint16_t maxLines);
+
+EMSTATUS GLIB_textLayoutSet(GLIB_TextLayout *pLayout, const GLIB_Font *pFont,
+                            const char *pString, uint16_t sLength,
+                            const GLIB_Rectangle *pBox);
+
+EMSTATUS GLIB_textLayoutPosition(const GLIB_TextLayout *pLayout, uint16_t index,
+                                 uint16_t *pX, uint16_t *pY);
+
+EMSTATUS GLIB_drawTextLayout(const GLIB_Context *pContext, const GLIB_TextLayout *pLayout,
+                             uint32_t opaque);
+
+EMSTATUS GLIB_drawBitmap(const GLIB_Context* pContext, uint16_t x, uint16_t y,
+                         uint16_t width, uint16_t height, uint8_t *picData);
+
+EMSTATUS GLIB_drawLine(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                       uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_drawLineAA(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                         uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_drawLineH(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                        uint16_t x2);
+
+EMSTATUS GLIB_drawLineV(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                        uint16_t y2);
+
+EMSTATUS GLIB_drawRect(const GLIB_Context *pContext, GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_drawRectFilled(const GLIB_Context *pContext,
+                             GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_drawPolygon(const GLIB_Context *pContext,
+                          uint32_t numPoints, uint16_t *polyPoints);
+
+EMSTATUS GLIB_drawPolygonFilled(const GLIB_Context *pContext, uint32_t numPoints,
+                                const uint16_t *polyPoints, uint32_t fillRule);
+
+EMSTATUS GLIB_drawTriangleFilled(const GLIB_Context *pContext, uint16_t x0, uint16_t y0,
+                                 uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_drawPixelRGB(uint16_t x, uint16_t y,
+                           uint8_t red, uint8_t green, uint8_t blue);
+
+EMSTATUS GLIB_drawPixel(const GLIB_Context *pContext, uint16_t x, uint16_t y);
+
+EMSTATUS GLIB_drawPixelColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                             uint32_t color);
+
+EMSTATUS GLIB_writeColor(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                         uint16_t width, uint16_t height, uint32_t color);
+
+EMSTATUS GLIB_writeData(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                        uint16_t width, uint16_t height, const uint8_t *picData);
+
+EMSTATUS GLIB_writeDataNative(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint32_t *data);
+
+EMSTATUS GLIB_writeDataRGB565(const GLIB_Context *pContext, uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height, const uint16_t *data);
+
+EMSTATUS GLIB_setSurface(GLIB_Context *pContext, GLIB_Surface *pSurface);
+
+EMSTATUS GLIB_surfaceInit(GLIB_Surface *pSurface, uint16_t *pixels,
+                          uint16_t stride, const GLIB_Rectangle *pArea);
+
+EMSTATUS GLIB_surfaceInitSub(GLIB_Surface *pSub, const GLIB_Surface *pParent,
+                             const GLIB_Rectangle *pArea);
+
+EMSTATUS GLIB_surfaceFill(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                          uint16_t width, uint16_t height, uint32_t color);
+
+EMSTATUS GLIB_surfaceWrite(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height, const uint8_t *picData);
+
+EMSTATUS GLIB_surfaceWriteNative(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height, const uint32_t *data);
+
+EMSTATUS GLIB_surfaceWriteRGB565(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height, const uint16_t *data);
+
+EMSTATUS GLIB_flushSurface(const GLIB_Surface *pSurface, const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_clipStackInit(GLIB_ClipStack *pStack);
+
+EMSTATUS GLIB_setClipStack(GLIB_Context *pContext, GLIB_ClipStack *pStack);
+
+EMSTATUS GLIB_pushClipRegion(GLIB_Context *pContext, const GLIB_Rectangle *pRects,
+                             uint32_t numRects);
+
+EMSTATUS GLIB_pushClipExclude(GLIB_Context *pContext, const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_popClip(GLIB_Context *pContext);
+
+const GLIB_Rectangle *GLIB_getClipRects(const GLIB_Context *pContext, uint32_t *pNumRects);
+
+EMSTATUS GLIB_regionInit(GLIB_Region *pRegion, GLIB_Rectangle *rects, uint32_t maxRects);
+
+EMSTATUS GLIB_regionClear(GLIB_Region *pRegion);
+
+EMSTATUS GLIB_regionSetRect(GLIB_Region *pRegion, const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_regionCopy(GLIB_Region *pResult, const GLIB_Region *pRegion);
+
+EMSTATUS GLIB_regionUnion(GLIB_Region *pResult, const GLIB_Region *pA, const GLIB_Region *pB);
+
+EMSTATUS GLIB_regionIntersect(GLIB_Region *pResult, const GLIB_Region *pA,
+                              const GLIB_Region *pB);
+
+EMSTATUS GLIB_regionSubtract(GLIB_Region *pResult, const GLIB_Region *pA,
+                             const GLIB_Region *pB);
+
+EMSTATUS GLIB_regionTranslate(GLIB_Region *pRegion, int32_t dx, int32_t dy);
+
+uint32_t GLIB_regionContainsPoint(const GLIB_Region *pRegion, uint16_t x, uint16_t y);
+
+uint32_t GLIB_regionContainsRect(const GLIB_Region *pRegion, const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_dirtyInit(GLIB_DirtyRegion *pDirty);
+
+EMSTATUS GLIB_dirtyAdd(GLIB_DirtyRegion *pDirty, const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_setDirtyRegion(GLIB_Context *pContext, GLIB_DirtyRegion *pDirty);
+
+EMSTATUS GLIB_flushDirty(const GLIB_Context *pContext);
+
+EMSTATUS GLIB_glyphCacheInit(GLIB_GlyphCache *pCache, void *buffer, uint32_t size);
+
+EMSTATUS GLIB_glyphCacheFlush(GLIB_GlyphCache *pCache);
+
+const uint16_t *GLIB_glyphCacheLookup(GLIB_GlyphCache *pCache, const void *pFont,
+                                      uint16_t glyph, uint32_t foregroundColor,
+                                      uint32_t backgroundColor);
+
+uint16_t *GLIB_glyphCacheInsert(GLIB_GlyphCache *pCache, const void *pFont,
+                                uint16_t glyph, uint32_t foregroundColor,
+                                uint32_t backgroundColor);
+
+const uint32_t *GLIB_glyphCacheRamp(GLIB_GlyphCache *pCache, const GLIB_Context *pContext);
+
+EMSTATUS GLIB_setGlyphCache(GLIB_Context *pContext, GLIB_GlyphCache *pCache);
+
+EMSTATUS GLIB_displayListInit(GLIB_DisplayList *pList, uint16_t *buffer, uint32_t size);
+
+EMSTATUS GLIB_displayListReset(GLIB_DisplayList *pList);
+
+uint32_t GLIB_displayListChecksum(const GLIB_DisplayList *pList);
+
+EMSTATUS GLIB_displayListDraw(GLIB_Context *pContext, void *pList);
+
+EMSTATUS GLIB_displayListClear(GLIB_DisplayList *pList, const GLIB_Context *pContext);
+
+EMSTATUS GLIB_displayListDrawPixel(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                   uint16_t x, uint16_t y);
+
+EMSTATUS GLIB_displayListDrawLine(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                  uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_displayListDrawLineAA(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_displayListDrawRect(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                  const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_displayListDrawRectFilled(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                        const GLIB_Rectangle *pRect);
+
+EMSTATUS GLIB_displayListDrawCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x, uint16_t y, uint16_t radius);
+
+EMSTATUS GLIB_displayListDrawCircleFilled(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                          uint16_t x, uint16_t y, uint16_t radius);
+
+EMSTATUS GLIB_displayListDrawPartialCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                           uint16_t x, uint16_t y, uint16_t radius,
+                                           uint8_t bitMask);
+
+EMSTATUS GLIB_displayListDrawArc(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                 uint16_t x, uint16_t y, uint16_t radius,
+                                 uint16_t startAngle, uint16_t endAngle);
+
+EMSTATUS GLIB_displayListDrawPolygon(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                     uint32_t numPoints, const uint16_t *polyPoints);
+
+EMSTATUS GLIB_displayListDrawPolygonFilled(GLIB_DisplayList *pList,
+                                           const GLIB_Context *pContext,
+                                           uint32_t numPoints, const uint16_t *polyPoints,
+                                           uint32_t fillRule);
+
+EMSTATUS GLIB_displayListDrawTriangleFilled(GLIB_DisplayList *pList,
+                                            const GLIB_Context *pContext,
+                                            uint16_t x0, uint16_t y0, uint16_t x1,
+                                            uint16_t y1, uint16_t x2, uint16_t y2);
+
+EMSTATUS GLIB_displayListDrawString(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    const char *pString, uint16_t sLength,
+                                    uint16_t x0, uint16_t y0, uint32_t opaque);
+
+EMSTATUS GLIB_displayListDrawBitmap(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                    const uint8_t *picData);
+
+EMSTATUS GLIB_renderBands(GLIB_Context *pContext, const GLIB_Rectangle *pArea,
+                          uint16_t *buffer, uint16_t tileWidth, uint16_t tileHeight,
+                          GLIB_DrawFunction drawFrame, void *pUser);
+#endif
@@ -0,0 +1,146 @@
+ /*************************************************************************//**
+ * @file glib_band.c
+ * @brief Energy Micro Graphics Library: Banded Rendering
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/**************************************************************************//**
+*  @brief
+*  Renders a frame one tile at a time through a small RAM buffer
+*
+*  The area is split into tiles of tileWidth x tileHeight pixels, visited
+*  row by row. For each tile, the buffer is set up as the surface of the
+*  GLIB_Context, the clipping region is narrowed to the tile, drawFrame is
+*  called to draw the whole frame and the tile is flushed to the display in
+*  one burst. Primitives that fall outside the tile are rejected by the
+*  clipping region, so a frame costs about one pass of drawing plus one
+*  burst per tile. A band of 320x16 pixels needs a 10 KB buffer.
+*
+*  Tiles are intersected with the clipping region of the context, so nothing
+*  outside it is drawn, and tiles that lie fully outside it are skipped. The
+*  surface and clipping region of the context are restored on return.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pArea
+*  Display area to render, or NULL for the whole clipping region
+*  @param buffer
+*  Pixel buffer of at least tileWidth * tileHeight RGB565 pixels
+*  @param tileWidth
+*  Width of a tile, or 0 for bands that span the whole area
+*  @param tileHeight
+*  Height of a tile
+*  @param drawFrame
+*  Function that draws the frame. It should draw everything, including the
+*  background, since the buffer is not cleared between tiles.
+*  @param pUser
+*  Passed on to drawFrame
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_renderBands(GLIB_Context *pContext, const GLIB_Rectangle *pArea,
+                          uint16_t *buffer, uint16_t tileWidth, uint16_t tileHeight,
+                          GLIB_DrawFunction drawFrame, void *pUser)
+{
+  /* Check arguments */
+  if (pContext == NULL || buffer == NULL || drawFrame == NULL) return GLIB_INVALID_ARGUMENT;
+  if (tileHeight == 0) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS       status   = GLIB_OK;
+  GLIB_Surface   *pSaved  = pContext->pSurface;
+  GLIB_Rectangle savedClip = pContext->clippingRegion;
+  GLIB_Rectangle area     = (pArea != NULL) ? *pArea : pContext->clippingRegion;
+  GLIB_Rectangle tile;
+  GLIB_Rectangle clip;
+  GLIB_Surface   surface;
+  uint32_t       xMax, yMax;
+
+  if ((area.xMin > area.xMax) || (area.yMin > area.yMax)) return GLIB_INVALID_ARGUMENT;
+
+  if (tileWidth == 0 || tileWidth > area.xMax - area.xMin + 1)
+  {
+    tileWidth = area.xMax - area.xMin + 1;
+  }
+
+  for (tile.yMin = area.yMin; status == GLIB_OK; tile.yMin = tile.yMax + 1)
+  {
+    yMax      = (uint32_t) tile.yMin + tileHeight - 1;
+    tile.yMax = (yMax > area.yMax) ? area.yMax : yMax;
+
+    for (tile.xMin = area.xMin; status == GLIB_OK; tile.xMin = tile.xMax + 1)
+    {
+      xMax      = (uint32_t) tile.xMin + tileWidth - 1;
+      tile.xMax = (xMax > area.xMax) ? area.xMax : xMax;
+
+      /* Only the part of the tile inside the caller's clipping region is drawn */
+      clip.xMin = (tile.xMin > savedClip.xMin) ? tile.xMin : savedClip.xMin;
+      clip.yMin = (tile.yMin > savedClip.yMin) ? tile.yMin : savedClip.yMin;
+      clip.xMax = (tile.xMax < savedClip.xMax) ? tile.xMax : savedClip.xMax;
+      clip.yMax = (tile.yMax < savedClip.yMax) ? tile.yMax : savedClip.yMax;
+
+      if ((clip.xMin <= clip.xMax) && (clip.yMin <= clip.yMax))
+      {
+        status = GLIB_surfaceInit(&surface, buffer, clip.xMax - clip.xMin + 1, &clip);
+        if (status != GLIB_OK) break;
+
+        /* Draw the frame with everything outside the tile clipped away */
+        pContext->pSurface       = &surface;
+        pContext->clippingRegion = clip;
+        status = drawFrame(pContext, pUser);
+        if (status == GLIB_DID_NOT_DRAW) status = GLIB_OK;
+        if (status != GLIB_OK) break;
+
+        pContext->pSurface       = pSaved;
+        pContext->clippingRegion = savedClip;
+        status = GLIB_flushSurface(&surface, NULL);
+      }
+
+      if (tile.xMax == area.xMax) break;
+    }
+
+    if (tile.yMax == area.yMax) break;
+  }
+
+  pContext->pSurface       = pSaved;
+  pContext->clippingRegion = savedClip;
+
+  return status;
+}
@@ -1,385 +1,559 @@
- /*************************************************************************//**
- * @file glib_circle.c
- * @brief Energy Micro Graphics Library: Circle Drawing Routines
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-/* Standard C header files */
-#include <stdint.h>
-/* EM types */
-#include "em_types.h"
-
-/* GLIB header files */
-#include "glib.h"
-
-/* Local function prototypes */
-static EMSTATUS GLIB_drawCirclePoints(const GLIB_Context *pContext,
-                                      uint16_t xCenter, uint16_t yCenter,
-                                      uint16_t x, uint16_t y);
-
-static EMSTATUS GLIB_drawPartialCirclePoints(const GLIB_Context *pContext,
-                                             uint16_t xCenter, uint16_t yCenter,
-                                             uint16_t x, uint16_t y, uint8_t bitMask);
-
-/**************************************************************************//**
-*  @brief
-*  Draws a circle with center at x, y, and a radius
-*
-*  Draws a circle using the Midpoint Circle Algorithm. See Wikipedia for algorithm.
-*  Algorithm is optimized to use only integer arithmetic, so no floating
-*  point arithmetic is needed.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using
-*  the foreground color.
-*  @param xCenter
-*  Center x-coordinate
-*  @param yCenter
-*  Center y-coordinate
-*  @param radius
-*  Radius of the circle
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawCircle(const GLIB_Context *pContext, uint16_t xCenter,
-                         uint16_t yCenter, uint16_t radius)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Bounds checking */
-  if (GLIB_rectContainsPoint(&(pContext->clippingRegion), xCenter, yCenter) == 0)
-    return GLIB_OUT_OF_BOUNDS;
-
-  EMSTATUS status;
-
-  /* Reset clipping area in DMD driver */
-  status = GLIB_resetDisplayClippingArea(pContext);
-  if (status != 0) return status;
-
-  uint16_t x       = 0;
-  uint16_t y       = radius;
-  int16_t  d       = 1 - radius;
-  uint32_t didDraw = 0;
-
-  /* Draw initial circle points */
-  status = GLIB_drawCirclePoints(pContext, xCenter, yCenter, x, y);
-  if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-  if (status == 0) didDraw = 1;
-
-  /* Loops through all points from 0 to 45 degrees of the circle
-   * (0 is defined straight upward) */
-  while (x < y)
-  {
-    x++;
-    if (d < 0)
-    {
-      d += 2 * x + 1;
-    }
-    else
-    {
-      y--;
-      d += 2 * (x - y) + 1;
-    }
-
-    /* Draws the circle points using 8-way symmetry */
-    status = GLIB_drawCirclePoints(pContext, xCenter, yCenter, x, y);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (status == 0) didDraw = 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a partial circle with center at x, y, and a radius
-*
-*  Draws a partial circle using the Midpoint Circle Algorithm. Algorithm is
-*  optimized to use only integer arithmetic, so no floating point arithmetic is
-*  needed. The bitMask passed in decides which octant that should be drawn.
-*  The octants is numbered 1 to 8 in counterclockwise order.
-*
-*  Example: bitMask == 4 draws only pixels in 3. octant (00000100).
-*  bitMask == 5 draws only pixels in 3. and 1. octant (00000101).
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
-*  @param xCenter
-*  Center x-coordinate
-*  @param yCenter
-*  Center y-coordinate
-*  @param radius
-*  Radius of the circle
-*  @param bitMask
-*  Bitmask which decides which octants pixels should be drawn.
-*  The LSB is 1. octant, and the MSB is 8. octant.
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawPartialCircle(const GLIB_Context *pContext, uint16_t xCenter,
-                                uint16_t yCenter, uint16_t radius, uint8_t bitMask)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Bounds checking */
-  if (GLIB_rectContainsPoint(&(pContext->clippingRegion), xCenter, yCenter) == 0)
-    return GLIB_OUT_OF_BOUNDS;
-
-  EMSTATUS status;
-
-  uint16_t x       = 0;
-  uint16_t y       = radius;
-  int16_t  d       = 1 - radius;
-  uint32_t didDraw = 0;
-
-  /* Draw initial circle points */
-  status = GLIB_drawPartialCirclePoints(pContext, xCenter, yCenter, x, y, bitMask);
-  if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-  if (status == 0) didDraw = 1;
-
-  /* Loops through all points from 0 to 45 degrees of the circle
-   * (0 is defined straight upward) */
-  while (x < y)
-  {
-    x++;
-    if (d < 0)
-    {
-      d += 2 * x + 1;
-    }
-    else
-    {
-      y--;
-      d += 2 * (x - y) + 1;
-    }
-
-    /* Draws the circle points using 8-way symmetry */
-    status = GLIB_drawPartialCirclePoints(pContext, xCenter, yCenter, x, y, bitMask);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (status == 0) didDraw = 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a filled circle with center at x, y, and a radius.
-*
-*  Draws a circle using the Midpoint Circle Algorithm and using horizontal lines.
-*  See Wikipedia for algorithm.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
-*  @param xCenter
-*  Center x-coordinate
-*  @param yCenter
-*  Center y-coordinate
-*  @param radius
-*  Radius of the circle
-*
-*  @return
-*  Returns GLIB_OK on succes.
-*  Returns GLIB_DID_NOT_DRAW if none of the points were drawn.
-*  Returns error code otherwise.
-******************************************************************************/
-
-EMSTATUS GLIB_drawCircleFilled(const GLIB_Context *pContext, uint16_t xCenter,
-                               uint16_t yCenter, uint16_t radius)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Bounds checking */
-  if (GLIB_rectContainsPoint(&(pContext->clippingRegion), xCenter, yCenter) == 0)
-    return GLIB_OUT_OF_BOUNDS;
-
-  EMSTATUS status;
-
-  uint16_t x       = 0;
-  uint16_t y       = radius;
-  int16_t  d       = 1 - radius;
-  uint32_t didDraw = 0;
-
-  /* Draws the initial circle line */
-  status = GLIB_drawLineH(pContext, xCenter - y, yCenter, xCenter + y);
-  if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-  if (status == 0) didDraw = 1;
-
-  /* Loops through all points from 0 to 45 degrees of the circle
-   * (0 is defined straight upward) */
-  while (x < y)
-  {
-    /* Midpoint Circle algorithm */
-    x++;
-    if (d < 0)
-    {
-      d += 2 * x + 1;
-    }
-    else
-    {
-      y--;
-      d += 2 * (x - y) + 1;
-    }
-
-    /* Draws horizontal lines using 4 way symmetry */
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter + y, xCenter + x);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (!didDraw && status == 0) didDraw = 1;
-
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter + x, xCenter + y);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (!didDraw && status == 0) didDraw = 1;
-
-    status = GLIB_drawLineH(pContext, xCenter - x, yCenter - y, xCenter + x);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (!didDraw && status == 0) didDraw = 1;
-
-    status = GLIB_drawLineH(pContext, xCenter - y, yCenter - x, xCenter + y);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (!didDraw && status == 0) didDraw = 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws circle points using 8-way symmetry.
-*
-*  Example: bitMask = 4 draws only pixels in 3. octant (00000100).
-*  bitMask = 5 draws only pixels in 3. and 1. octant (00000101).
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
-*  @param xCenter
-*  Center x-coordinate
-*  @param yCenter
-*  Center y-coordinate
-*  @param x
-*  x-coordinate of circle point
-*  @param y
-*  y-coordinate of circle point
-*  @param bitMask
-*  Bitmask which decides which octants pixels should be drawn
-*  The LSB is 1. octant, and the MSB is 8. octant. The octants are ordered from 1 to 8
-*  in counterclockwise order.
-*
-*  @return
-*  - Returns GLIB_OK on succes.
-*  - Returns GLIB_DID_NOT_DRAW if none of the points were drawn
-*  - Returns error code otherwise
-******************************************************************************/
-static EMSTATUS GLIB_drawPartialCirclePoints(const GLIB_Context *pContext,
-                                             uint16_t xCenter, uint16_t yCenter,
-                                             uint16_t x, uint16_t y, uint8_t bitMask)
-{
-  EMSTATUS status;
-  uint32_t didDraw = 0;
-  int32_t  i;
-
-  int32_t  xOffsets[8] = { y, x, -x, -y, -y, -x, x, y };
-  int32_t  yOffsets[8] = { -x, -y, -y, -x, x, y, y, x };
-
-  /* Draws the circle points using 8-way symmetry */
-
-  for (i = 0; i < 8; ++i)
-  {
-    /* Pixel in i+1. octant */
-    if ((bitMask & 1) != 0)
-    {
-      status = GLIB_drawPixel(pContext, xCenter + xOffsets[i], yCenter + yOffsets[i]);
-      if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-      if (!didDraw && status == 0) didDraw = 1;
-    }
-
-    bitMask >>= 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws circle points using 8-way symmetry
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
-*  @param xCenter
-*  Center x-coordinate
-*  @param yCenter
-*  Center y-coordinate
-*  @param x
-*  x-coordinate of circle point
-*  @param y
-*  y-coordinate of circle point
-*
-*  @return
-*  - Returns GLIB_OK on succes
-*  - Returns GLIB_DID_NOT_DRAW if none of the points were drawn
-*  - Returns error code otherwise
-******************************************************************************/
-static EMSTATUS GLIB_drawCirclePoints(const GLIB_Context *pContext,
-                                      uint16_t xCenter, uint16_t yCenter,
-                                      uint16_t x, uint16_t y)
-{
-  EMSTATUS status;
-  uint32_t didDraw = 0;
-  int32_t  i;
-
-  int32_t  xOffsets[8] = { y, x, -x, -y, -y, -x, x, y };
-  int32_t  yOffsets[8] = { -x, -y, -y, -x, x, y, y, x };
-
-  /* Draws the circle points using 8-way symmetry */
-  for (i = 0; i < 8; ++i)
-  {
-    /* Pixel in i+1. octant */
-    status = GLIB_drawPixel(pContext, xCenter + xOffsets[i], yCenter + yOffsets[i]);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (!didDraw && status == 0) didDraw = 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
-
-
+ /*************************************************************************//**
+ * @file glib_circle.c
+ * @brief Energy Micro Graphics Library: Circle Drawing Routines
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Arc limits as direction vectors, used to decide which pixels of the
+ * outline are drawn */
+typedef struct
+{
+  /* Directions of the start and end angle, scaled by 2^14, y pointing up */
+  int32_t  startX;
+  int32_t  startY;
+  int32_t  endX;
+  int32_t  endY;
+
+  /* 1 if the arc is longer than half a circle */
+  uint32_t large;
+} GLIB_ArcLimits;
+
+/* sin() of 0 to 90 degrees, scaled by 2^14 */
+static const uint16_t sinTable[91] =
+{
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+/* Signs of the x and y offsets from the center of the pixels in each
+ * octant. The octants are numbered counterclockwise from the right. */
+static const int8_t octantXSigns[8] = { 1, 1, -1, -1, -1, -1, 1, 1 };
+static const int8_t octantYSigns[8] = { -1, -1, -1, -1, 1, 1, 1, 1 };
+
+/* Octants 1, 4, 5 and 8, where the runs of the outline are vertical */
+#define VERTICAL_OCTANTS    0x99
+
+/* Local function prototypes */
+static EMSTATUS drawCircleOutline(const GLIB_Context *pContext,
+                                  uint16_t xCenter, uint16_t yCenter,
+                                  uint16_t radius, uint8_t bitMask,
+                                  const GLIB_ArcLimits *pArc);
+
+static EMSTATUS drawCircleRun(const GLIB_Context *pContext,
+                              uint16_t xCenter, uint16_t yCenter,
+                              int32_t xStart, int32_t xEnd, int32_t y,
+                              uint8_t bitMask, const GLIB_ArcLimits *pArc);
+
+static EMSTATUS drawCircleSpan(const GLIB_Context *pContext, int32_t x1, int32_t y1,
+                               int32_t x2, int32_t y2);
+
+static void angleVector(uint16_t angle, int32_t *pX, int32_t *pY);
+
+static uint32_t insideArc(const GLIB_ArcLimits *pArc, int32_t x, int32_t y);
+
+static uint32_t insideCircle(int32_t x, int32_t y, uint16_t radius);
+
+/**************************************************************************//**
+*  @brief
+*  Draws a circle with center at x, y, and a radius
+*
+*  Draws a circle using the Midpoint Circle Algorithm. See Wikipedia for algorithm.
+*  Algorithm is optimized to use only integer arithmetic, so no floating
+*  point arithmetic is needed. Pixels that line up are drawn as one run.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using
+*  the foreground color.
+*  @param xCenter
+*  Center x-coordinate
+*  @param yCenter
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_DID_NOT_DRAW if no pixel of the circle is inside the
+*    clipping region. A center outside the clipping region is not an error,
+*    the part of the circle inside it is drawn.
+*  - Returns error code otherwise
+******************************************************************************/
+
+EMSTATUS GLIB_drawCircle(const GLIB_Context *pContext, uint16_t xCenter,
+                         uint16_t yCenter, uint16_t radius)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  return drawCircleOutline(pContext, xCenter, yCenter, radius, 0xFF, NULL);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a partial circle with center at x, y, and a radius
+*
+*  Draws a partial circle using the Midpoint Circle Algorithm. Algorithm is
+*  optimized to use only integer arithmetic, so no floating point arithmetic is
+*  needed. The bitMask passed in decides which octant that should be drawn.
+*  The octants is numbered 1 to 8 in counterclockwise order.
+*  GLIB_drawArc() draws between any two angles.
+*
+*  Example: bitMask == 4 draws only pixels in 3. octant (00000100).
+*  bitMask == 5 draws only pixels in 3. and 1. octant (00000101).
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
+*  @param xCenter
+*  Center x-coordinate
+*  @param yCenter
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*  @param bitMask
+*  Bitmask which decides which octants pixels should be drawn.
+*  The LSB is 1. octant, and the MSB is 8. octant.
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_DID_NOT_DRAW if no pixel of the circle is inside the
+*    clipping region. A center outside the clipping region is not an error,
+*    the part of the circle inside it is drawn.
+*  - Returns error code otherwise
+******************************************************************************/
+
+EMSTATUS GLIB_drawPartialCircle(const GLIB_Context *pContext, uint16_t xCenter,
+                                uint16_t yCenter, uint16_t radius, uint8_t bitMask)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  return drawCircleOutline(pContext, xCenter, yCenter, radius, bitMask, NULL);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws an arc of a circle with center at x, y, and a radius
+*
+*  The arc is the part of the outline drawn by GLIB_drawCircle() that goes
+*  counterclockwise from startAngle to endAngle. Angles are in degrees,
+*  where 0 points right and 90 points up.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the arc is drawn. The arc is drawn using the foreground color.
+*  @param xCenter
+*  Center x-coordinate
+*  @param yCenter
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*  @param startAngle
+*  Angle where the arc starts
+*  @param endAngle
+*  Angle where the arc ends. The whole circle is drawn if it is 360 degrees
+*  or more after startAngle.
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_DID_NOT_DRAW if no pixel of the arc is inside the
+*    clipping region. A center outside the clipping region is not an error,
+*    the part of the arc inside it is drawn.
+*  - Returns error code otherwise
+******************************************************************************/
+
+EMSTATUS GLIB_drawArc(const GLIB_Context *pContext, uint16_t xCenter, uint16_t yCenter,
+                      uint16_t radius, uint16_t startAngle, uint16_t endAngle)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  GLIB_ArcLimits arc;
+  uint32_t       sweep;
+
+  if ((uint32_t) endAngle >= (uint32_t) startAngle + 360)
+  {
+    return drawCircleOutline(pContext, xCenter, yCenter, radius, 0xFF, NULL);
+  }
+
+  sweep = (endAngle % 360 + 360 - startAngle % 360) % 360;
+  if (sweep == 0) return GLIB_DID_NOT_DRAW;
+
+  angleVector(startAngle, &arc.startX, &arc.startY);
+  angleVector(endAngle, &arc.endX, &arc.endY);
+  arc.large = (sweep > 180);
+
+  return drawCircleOutline(pContext, xCenter, yCenter, radius, 0xFF, &arc);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a filled circle with center at x, y, and a radius.
+*
+*  The disc covers the same pixels as the outline drawn by the Midpoint
+*  Circle Algorithm and everything inside it. It is drawn from top to bottom
+*  with one horizontal span per row, so no pixel is written twice.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the circle is drawn. The circle is drawn using the foreground color.
+*  @param xCenter
+*  Center x-coordinate
+*  @param yCenter
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_DID_NOT_DRAW if no pixel of the circle is inside the
+*    clipping region. A center outside the clipping region is not an error,
+*    the part of the circle inside it is drawn.
+*  - Returns error code otherwise
+******************************************************************************/
+
+EMSTATUS GLIB_drawCircleFilled(const GLIB_Context *pContext, uint16_t xCenter,
+                               uint16_t yCenter, uint16_t radius)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  /* Check if the entire circle is outside the clipping region */
+  if (((int32_t) xCenter + radius < pContext->clippingRegion.xMin) ||
+      ((int32_t) xCenter - radius > pContext->clippingRegion.xMax) ||
+      ((int32_t) yCenter + radius < pContext->clippingRegion.yMin) ||
+      ((int32_t) yCenter - radius > pContext->clippingRegion.yMax))
+    return GLIB_DID_NOT_DRAW;
+
+  EMSTATUS status;
+  int32_t  y, dy;
+  int32_t  xMin, xMax;
+  int32_t  halfWidth = 0;
+  uint32_t didDraw   = 0;
+
+  /* Half width of the top row */
+  while (insideCircle(halfWidth + 1, radius, radius)) halfWidth++;
+
+  for (y = (int32_t) yCenter - radius; y <= (int32_t) yCenter + radius; y++)
+  {
+    /* The half width grows towards the middle row and shrinks after it */
+    if (y <= yCenter)
+    {
+      dy = yCenter - y;
+      while (insideCircle(halfWidth + 1, dy, radius)) halfWidth++;
+    }
+    else
+    {
+      dy = y - yCenter;
+      while ((halfWidth > 0) && !insideCircle(halfWidth, dy, radius)) halfWidth--;
+    }
+
+    if (y < pContext->clippingRegion.yMin) continue;
+    if (y > pContext->clippingRegion.yMax) break;
+
+    /* Clip the span */
+    xMin = (int32_t) xCenter - halfWidth;
+    xMax = (int32_t) xCenter + halfWidth;
+    if (xMin < pContext->clippingRegion.xMin) xMin = pContext->clippingRegion.xMin;
+    if (xMax > pContext->clippingRegion.xMax) xMax = pContext->clippingRegion.xMax;
+    if (xMin > xMax) continue;
+
+    status = GLIB_writeColor(pContext, xMin, y, xMax - xMin + 1, 1,
+                             pContext->foregroundColor);
+    if (status != GLIB_OK) return status;
+    didDraw = 1;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if the pixel at offset x, y from the center is on or inside the
+*  outline of a circle drawn by the Midpoint Circle Algorithm
+*
+*  The algorithm keeps y for the next x when the midpoint between y and y - 1
+*  is inside the circle, that is when x^2 + (y - 1/2)^2 < r^2. For integers
+*  this is x^2 + y^2 - y < r^2, and mirrored for the other octants.
+******************************************************************************/
+static uint32_t insideCircle(int32_t x, int32_t y, uint16_t radius)
+{
+  int64_t major = (x > y) ? x : y;
+
+  return ((int64_t) x * x + (int64_t) y * y - major) < (int64_t) radius * radius;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the outline of a circle using the Midpoint Circle Algorithm
+*
+*  The algorithm walks the octant from the top of the circle to 45 degrees.
+*  Each run of pixels on one row is drawn in all selected octants at once,
+*  as horizontal runs near the top and bottom and vertical runs near the
+*  sides.
+*
+*  @param bitMask
+*  Bitmask which decides which octants pixels should be drawn
+*  @param pArc
+*  Arc limits, or NULL to draw the whole octants
+*
+*  @return
+*  - Returns GLIB_OK on succes.
+*  - Returns GLIB_DID_NOT_DRAW if none of the points were drawn
+*  - Returns error code otherwise
+******************************************************************************/
+static EMSTATUS drawCircleOutline(const GLIB_Context *pContext,
+                                  uint16_t xCenter, uint16_t yCenter,
+                                  uint16_t radius, uint8_t bitMask,
+                                  const GLIB_ArcLimits *pArc)
+{
+  /* Check if the entire circle is outside the clipping region */
+  if (((int32_t) xCenter + radius < pContext->clippingRegion.xMin) ||
+      ((int32_t) xCenter - radius > pContext->clippingRegion.xMax) ||
+      ((int32_t) yCenter + radius < pContext->clippingRegion.yMin) ||
+      ((int32_t) yCenter - radius > pContext->clippingRegion.yMax))
+    return GLIB_DID_NOT_DRAW;
+
+  EMSTATUS status;
+  int32_t  x        = 0;
+  int32_t  y        = radius;
+  int32_t  d        = 1 - radius;
+  int32_t  runStart = 0;
+  uint32_t didDraw  = 0;
+
+  /* Loops through all points from 0 to 45 degrees of the circle
+   * (0 is defined straight upward) */
+  while (x < y)
+  {
+    x++;
+    if (d < 0)
+    {
+      d += 2 * x + 1;
+    }
+    else
+    {
+      /* The run on this row ended at the previous point */
+      status = drawCircleRun(pContext, xCenter, yCenter, runStart, x - 1, y,
+                             bitMask, pArc);
+      if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+      if (status == 0) didDraw = 1;
+
+      runStart = x;
+      y--;
+      d += 2 * (x - y) + 1;
+    }
+  }
+
+  status = drawCircleRun(pContext, xCenter, yCenter, runStart, x, y, bitMask, pArc);
+  if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+  if (status == 0) didDraw = 1;
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the points xStart to xEnd on row y of the first octant walk into
+*  the selected octants using 8-way symmetry
+*
+*  Within an arc, the points of a run that are inside the arc are drawn as
+*  one span for each unbroken stretch.
+*
+*  @return
+*  - Returns GLIB_OK on succes.
+*  - Returns GLIB_DID_NOT_DRAW if none of the points were drawn
+*  - Returns error code otherwise
+******************************************************************************/
+static EMSTATUS drawCircleRun(const GLIB_Context *pContext,
+                              uint16_t xCenter, uint16_t yCenter,
+                              int32_t xStart, int32_t xEnd, int32_t y,
+                              uint8_t bitMask, const GLIB_ArcLimits *pArc)
+{
+  EMSTATUS status;
+  uint32_t didDraw = 0;
+  uint32_t octant;
+  int32_t  i, first;
+  int32_t  xSign, ySign;
+
+  for (octant = 0; octant < 8; octant++)
+  {
+    /* Pixels in octant + 1 */
+    if ((bitMask & (1 << octant)) == 0) continue;
+
+    uint32_t vertical = (VERTICAL_OCTANTS >> octant) & 1;
+    xSign = octantXSigns[octant];
+    ySign = octantYSigns[octant];
+
+    first = xStart;
+    for (i = xStart; i <= xEnd + 1; i++)
+    {
+      if (i <= xEnd)
+      {
+        /* Extend the span while the points are inside the arc */
+        if (pArc == NULL)
+        {
+          i = xEnd;
+          continue;
+        }
+        if (vertical ? insideArc(pArc, xSign * y, ySign * i)
+                     : insideArc(pArc, xSign * i, ySign * y))
+        {
+          continue;
+        }
+      }
+
+      if (i > first)
+      {
+        if (vertical)
+        {
+          status = drawCircleSpan(pContext,
+                                  xCenter + xSign * y, yCenter + ySign * first,
+                                  xCenter + xSign * y, yCenter + ySign * (i - 1));
+        }
+        else
+        {
+          status = drawCircleSpan(pContext,
+                                  xCenter + xSign * first, yCenter + ySign * y,
+                                  xCenter + xSign * (i - 1), yCenter + ySign * y);
+        }
+        if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+        if (status == 0) didDraw = 1;
+      }
+      first = i + 1;
+    }
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a horizontal or vertical span between two pixels, clipped against
+*  the clipping region
+*
+*  @return
+*  - Returns GLIB_OK on succes.
+*  - Returns GLIB_DID_NOT_DRAW if the span is outside the clipping region
+*  - Returns error code otherwise
+******************************************************************************/
+static EMSTATUS drawCircleSpan(const GLIB_Context *pContext, int32_t x1, int32_t y1,
+                               int32_t x2, int32_t y2)
+{
+  int32_t xMin = (x1 < x2) ? x1 : x2;
+  int32_t xMax = (x1 < x2) ? x2 : x1;
+  int32_t yMin = (y1 < y2) ? y1 : y2;
+  int32_t yMax = (y1 < y2) ? y2 : y1;
+
+  if (xMin < pContext->clippingRegion.xMin) xMin = pContext->clippingRegion.xMin;
+  if (yMin < pContext->clippingRegion.yMin) yMin = pContext->clippingRegion.yMin;
+  if (xMax > pContext->clippingRegion.xMax) xMax = pContext->clippingRegion.xMax;
+  if (yMax > pContext->clippingRegion.yMax) yMax = pContext->clippingRegion.yMax;
+  if ((xMin > xMax) || (yMin > yMax)) return GLIB_DID_NOT_DRAW;
+
+  return GLIB_writeColor(pContext, xMin, yMin, xMax - xMin + 1, yMax - yMin + 1,
+                         pContext->foregroundColor);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the direction of an angle in degrees as a vector scaled by 2^14,
+*  with y pointing up
+******************************************************************************/
+static void angleVector(uint16_t angle, int32_t *pX, int32_t *pY)
+{
+  int32_t sine, cosine;
+
+  angle %= 360;
+  sine   = sinTable[angle % 90];
+  cosine = sinTable[90 - angle % 90];
+
+  switch (angle / 90)
+  {
+  case 0:
+    *pX = cosine;
+    *pY = sine;
+    break;
+  case 1:
+    *pX = -sine;
+    *pY = cosine;
+    break;
+  case 2:
+    *pX = -cosine;
+    *pY = -sine;
+    break;
+  default:
+    *pX = sine;
+    *pY = -cosine;
+    break;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if the pixel at offset x, y from the center lies between the
+*  start and end angle of an arc
+******************************************************************************/
+static uint32_t insideArc(const GLIB_ArcLimits *pArc, int32_t x, int32_t y)
+{
+  /* The limits have y pointing up */
+  y = -y;
+
+  /* Counterclockwise from the start, and clockwise from the end */
+  int32_t afterStart = pArc->startX * y - pArc->startY * x;
+  int32_t beforeEnd  = x * pArc->endY - y * pArc->endX;
+
+  if (pArc->large)
+  {
+    /* Inside unless it is in the gap from the end to the start */
+    return (afterStart >= 0) || (beforeEnd >= 0);
+  }
+
+  return (afterStart >= 0) && (beforeEnd >= 0);
+}
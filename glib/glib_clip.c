@@ -0,0 +1,403 @@
+ /*************************************************************************//**
+ * @file glib_clip.c
+ * @brief Energy Micro Graphics Library: Clip Regions
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Local function prototypes */
+static GLIB_ClipLevel *beginPush(GLIB_Context *pContext, const GLIB_Rectangle **ppSource,
+                                 uint32_t *pNumSource);
+static uint32_t addRect(const GLIB_Context *pContext, GLIB_ClipLevel *pLevel,
+                        uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax);
+static void endPush(GLIB_Context *pContext, GLIB_ClipLevel *pLevel);
+
+/**************************************************************************//**
+*  @brief
+*  Starts a push on the clip stack of a GLIB_Context. The new level is set
+*  up above the current one, but the depth is only increased by endPush().
+*
+*  @param ppSource
+*  Set to the rectangles of the current region, or to the clipping region
+*  of the context if no region is pushed
+*  @param pNumSource
+*  Set to the number of rectangles in *ppSource
+*
+*  @return
+*  Returns the new level, or NULL if the stack is full
+******************************************************************************/
+static GLIB_ClipLevel *beginPush(GLIB_Context *pContext, const GLIB_Rectangle **ppSource,
+                                 uint32_t *pNumSource)
+{
+  GLIB_ClipStack *pStack = pContext->pClipStack;
+  GLIB_ClipLevel *pTop   = &pStack->levels[pStack->depth];
+  GLIB_ClipLevel *pLevel;
+
+  if (pStack->depth >= GLIB_CLIP_STACK_DEPTH) return NULL;
+
+  pLevel            = pTop + 1;
+  pLevel->savedClip = pContext->clippingRegion;
+  pLevel->firstRect = pTop->firstRect + (pTop->hasRegion ? pTop->numRects : 0);
+  pLevel->numRects  = 0;
+  pLevel->hasRegion = 1;
+
+  if (pTop->hasRegion)
+  {
+    *ppSource   = &pStack->rects[pTop->firstRect];
+    *pNumSource = pTop->numRects;
+  }
+  else
+  {
+    *ppSource   = &pContext->clippingRegion;
+    *pNumSource = 1;
+  }
+
+  return pLevel;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a rectangle to the region of a level that is being pushed. The part
+*  outside the clipping region of the context is left out, since the region
+*  may be pushed while the clipping region is narrowed to a band.
+*
+*  @return
+*  Returns 1 on success, or 0 if the stack has no room for the rectangle
+******************************************************************************/
+static uint32_t addRect(const GLIB_Context *pContext, GLIB_ClipLevel *pLevel,
+                        uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax)
+{
+  const GLIB_Rectangle *pClip = &pContext->clippingRegion;
+  GLIB_Rectangle       *pRect;
+
+  if (xMin < pClip->xMin) xMin = pClip->xMin;
+  if (yMin < pClip->yMin) yMin = pClip->yMin;
+  if (xMax > pClip->xMax) xMax = pClip->xMax;
+  if (yMax > pClip->yMax) yMax = pClip->yMax;
+  if ((xMin > xMax) || (yMin > yMax)) return 1;
+
+  if (pLevel->firstRect + pLevel->numRects >= GLIB_CLIP_MAX_RECTS) return 0;
+
+  pRect       = &pContext->pClipStack->rects[pLevel->firstRect + pLevel->numRects];
+  pRect->xMin = xMin;
+  pRect->yMin = yMin;
+  pRect->xMax = xMax;
+  pRect->yMax = yMax;
+  pLevel->numRects++;
+
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Completes a push. The clipping region of the context is narrowed to the
+*  bounding box of the new region, so that primitives reject and clip
+*  against it as before and only the spans inside it are split.
+******************************************************************************/
+static void endPush(GLIB_Context *pContext, GLIB_ClipLevel *pLevel)
+{
+  const GLIB_Rectangle *pRects = &pContext->pClipStack->rects[pLevel->firstRect];
+  GLIB_Rectangle       box;
+  uint32_t             i;
+
+  pContext->pClipStack->depth++;
+
+  /* An empty region keeps the clipping region, since it cannot be empty.
+   * Every span is then rejected by the region. */
+  if (pLevel->numRects == 0) return;
+
+  box = pRects[0];
+  for (i = 1; i < pLevel->numRects; i++)
+  {
+    if (pRects[i].xMin < box.xMin) box.xMin = pRects[i].xMin;
+    if (pRects[i].yMin < box.yMin) box.yMin = pRects[i].yMin;
+    if (pRects[i].xMax > box.xMax) box.xMax = pRects[i].xMax;
+    if (pRects[i].yMax > box.yMax) box.yMax = pRects[i].yMax;
+  }
+
+  pContext->clippingRegion = box;
+
+  /* A single rectangle is the clipping region itself */
+  if (pLevel->numRects == 1) pLevel->hasRegion = 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize a clip stack with no regions pushed
+*
+*  @param pStack
+*  Pointer to the GLIB_ClipStack
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_clipStackInit(GLIB_ClipStack *pStack)
+{
+  /* Check arguments */
+  if (pStack == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pStack->depth               = 0;
+  pStack->levels[0].firstRect = 0;
+  pStack->levels[0].numRects  = 0;
+  pStack->levels[0].hasRegion = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Make the GLIB_Context clip to the regions pushed on a clip stack
+*
+*  While a region of more than one rectangle is pushed, GLIB_writeColor(),
+*  GLIB_writeData() and GLIB_writeDataNative() split each span they are
+*  given into the parts inside the rectangles. Primitives clip to the
+*  bounding box of the region as before, so nothing is tested per pixel.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pStack
+*  Pointer to the clip stack, or NULL to clip to the clipping region only
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setClipStack(GLIB_Context *pContext, GLIB_ClipStack *pStack)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pContext->pClipStack = pStack;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Pushes the intersection of the current clip region and a set of
+*  rectangles
+*
+*  Drawing is limited to the new region until GLIB_popClip() is called.
+*  Display lists cannot record the region, so their record functions return
+*  GLIB_INVALID_CLIPPINGREGION until it is popped.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context with a clip stack
+*  @param pRects
+*  Rectangles that do not overlap each other
+*  @param numRects
+*  Number of rectangles
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_OUT_OF_MEMORY if the stack is full or has too few
+*    rectangles left. Nothing is pushed.
+*  - Returns error code otherwise
+******************************************************************************/
+EMSTATUS GLIB_pushClipRegion(GLIB_Context *pContext, const GLIB_Rectangle *pRects,
+                             uint32_t numRects)
+{
+  /* Check arguments */
+  if (pContext == NULL || pContext->pClipStack == NULL || pRects == NULL) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_Rectangle *pSource;
+  GLIB_ClipLevel       *pLevel;
+  uint32_t             numSource, i, j;
+  GLIB_Rectangle       rect;
+
+  for (i = 0; i < numRects; i++)
+  {
+    if ((pRects[i].xMin > pRects[i].xMax) || (pRects[i].yMin > pRects[i].yMax))
+    {
+      return GLIB_INVALID_CLIPPINGREGION;
+    }
+  }
+
+  pLevel = beginPush(pContext, &pSource, &numSource);
+  if (pLevel == NULL) return GLIB_OUT_OF_MEMORY;
+
+  /* Both sets are disjoint, so their pairwise intersections are too */
+  for (i = 0; i < numSource; i++)
+  {
+    for (j = 0; j < numRects; j++)
+    {
+      rect.xMin = (pSource[i].xMin > pRects[j].xMin) ? pSource[i].xMin : pRects[j].xMin;
+      rect.yMin = (pSource[i].yMin > pRects[j].yMin) ? pSource[i].yMin : pRects[j].yMin;
+      rect.xMax = (pSource[i].xMax < pRects[j].xMax) ? pSource[i].xMax : pRects[j].xMax;
+      rect.yMax = (pSource[i].yMax < pRects[j].yMax) ? pSource[i].yMax : pRects[j].yMax;
+      if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) continue;
+
+      if (!addRect(pContext, pLevel, rect.xMin, rect.yMin, rect.xMax, rect.yMax))
+      {
+        return GLIB_OUT_OF_MEMORY;
+      }
+    }
+  }
+
+  endPush(pContext, pLevel);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Pushes the current clip region with a rectangle cut out of it
+*
+*  Use it to draw around something that overlaps, such as a popup, in one
+*  pass. Each rectangle of the current region is split into at most four
+*  parts: the rows above and below the cut out rectangle, and the parts to
+*  its left and right.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context with a clip stack
+*  @param pRect
+*  Rectangle to cut out
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_OUT_OF_MEMORY if the stack is full or has too few
+*    rectangles left. Nothing is pushed.
+*  - Returns error code otherwise
+******************************************************************************/
+EMSTATUS GLIB_pushClipExclude(GLIB_Context *pContext, const GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pContext == NULL || pContext->pClipStack == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_INVALID_CLIPPINGREGION;
+
+  const GLIB_Rectangle *pSource;
+  GLIB_ClipLevel       *pLevel;
+  uint32_t             numSource, i, ok;
+  uint16_t             yMin, yMax;
+
+  pLevel = beginPush(pContext, &pSource, &numSource);
+  if (pLevel == NULL) return GLIB_OUT_OF_MEMORY;
+
+  for (i = 0; i < numSource; i++)
+  {
+    const GLIB_Rectangle *pSrc = &pSource[i];
+    ok = 1;
+
+    /* Not overlapping, keep it as it is */
+    if ((pRect->xMin > pSrc->xMax) || (pRect->xMax < pSrc->xMin) ||
+        (pRect->yMin > pSrc->yMax) || (pRect->yMax < pSrc->yMin))
+    {
+      ok = addRect(pContext, pLevel, pSrc->xMin, pSrc->yMin, pSrc->xMax, pSrc->yMax);
+    }
+    else
+    {
+      yMin = (pRect->yMin > pSrc->yMin) ? pRect->yMin : pSrc->yMin;
+      yMax = (pRect->yMax < pSrc->yMax) ? pRect->yMax : pSrc->yMax;
+
+      if (pSrc->yMin < yMin)
+      {
+        ok &= addRect(pContext, pLevel, pSrc->xMin, pSrc->yMin, pSrc->xMax, yMin - 1);
+      }
+      if (pSrc->xMin < pRect->xMin)
+      {
+        ok &= addRect(pContext, pLevel, pSrc->xMin, yMin, pRect->xMin - 1, yMax);
+      }
+      if (pSrc->xMax > pRect->xMax)
+      {
+        ok &= addRect(pContext, pLevel, pRect->xMax + 1, yMin, pSrc->xMax, yMax);
+      }
+      if (pSrc->yMax > yMax)
+      {
+        ok &= addRect(pContext, pLevel, pSrc->xMin, yMax + 1, pSrc->xMax, pSrc->yMax);
+      }
+    }
+
+    if (!ok) return GLIB_OUT_OF_MEMORY;
+  }
+
+  endPush(pContext, pLevel);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Pops the clip region pushed last, and restores the clipping region the
+*  context had before it was pushed
+*
+*  @param pContext
+*  Pointer to a GLIB_Context with a clip stack
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_popClip(GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL || pContext->pClipStack == NULL) return GLIB_INVALID_ARGUMENT;
+  if (pContext->pClipStack->depth == 0) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_ClipStack *pStack = pContext->pClipStack;
+
+  pContext->clippingRegion = pStack->levels[pStack->depth].savedClip;
+  pStack->depth--;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the rectangles of the clip region that limits drawing in a
+*  GLIB_Context, on top of its clipping region
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pNumRects
+*  Set to the number of rectangles
+*
+*  @return
+*  Returns the rectangles, or NULL if only the clipping region limits drawing
+******************************************************************************/
+const GLIB_Rectangle *GLIB_getClipRects(const GLIB_Context *pContext, uint32_t *pNumRects)
+{
+  const GLIB_ClipStack *pStack = pContext->pClipStack;
+  const GLIB_ClipLevel *pTop;
+
+  if (pStack == NULL) return NULL;
+
+  pTop = &pStack->levels[pStack->depth];
+  if (!pTop->hasRegion) return NULL;
+
+  *pNumRects = pTop->numRects;
+  return &pStack->rects[pTop->firstRect];
+}
@@ -0,0 +1,285 @@
+ /*************************************************************************//**
+ * @file glib_dirty.c
+ * @brief Energy Micro Graphics Library: Dirty Rectangle Tracking
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Local function prototypes */
+static uint32_t rectArea(const GLIB_Rectangle *pRect);
+static void rectUnion(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB,
+                      GLIB_Rectangle *pResult);
+static uint32_t mergeWaste(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB);
+static void removeRect(GLIB_DirtyRegion *pDirty, uint32_t index);
+static void coalesce(GLIB_DirtyRegion *pDirty, uint32_t index);
+
+/**************************************************************************//**
+*  @brief
+*  Returns the number of pixels in a rectangle
+******************************************************************************/
+static uint32_t rectArea(const GLIB_Rectangle *pRect)
+{
+  return (uint32_t) (pRect->xMax - pRect->xMin + 1) * (pRect->yMax - pRect->yMin + 1);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes the bounding box of two rectangles
+******************************************************************************/
+static void rectUnion(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB,
+                      GLIB_Rectangle *pResult)
+{
+  pResult->xMin = (pA->xMin < pB->xMin) ? pA->xMin : pB->xMin;
+  pResult->yMin = (pA->yMin < pB->yMin) ? pA->yMin : pB->yMin;
+  pResult->xMax = (pA->xMax > pB->xMax) ? pA->xMax : pB->xMax;
+  pResult->yMax = (pA->yMax > pB->yMax) ? pA->yMax : pB->yMax;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the number of pixels that are in the bounding box of two
+*  rectangles but in neither of them. This is what merging the two costs
+*  when the merged rectangle is flushed.
+******************************************************************************/
+static uint32_t mergeWaste(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB)
+{
+  GLIB_Rectangle bounds;
+  uint32_t       overlap = 0;
+  uint16_t       xMin, yMin, xMax, yMax;
+
+  rectUnion(pA, pB, &bounds);
+
+  /* Pixels covered by both rectangles are counted once */
+  xMin = (pA->xMin > pB->xMin) ? pA->xMin : pB->xMin;
+  yMin = (pA->yMin > pB->yMin) ? pA->yMin : pB->yMin;
+  xMax = (pA->xMax < pB->xMax) ? pA->xMax : pB->xMax;
+  yMax = (pA->yMax < pB->yMax) ? pA->yMax : pB->yMax;
+  if (xMin <= xMax && yMin <= yMax)
+  {
+    overlap = (uint32_t) (xMax - xMin + 1) * (yMax - yMin + 1);
+  }
+
+  return rectArea(&bounds) + overlap - rectArea(pA) - rectArea(pB);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Removes a rectangle from the dirty region by moving the last one into
+*  its place
+******************************************************************************/
+static void removeRect(GLIB_DirtyRegion *pDirty, uint32_t index)
+{
+  pDirty->numRects--;
+  pDirty->rects[index] = pDirty->rects[pDirty->numRects];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Merges the rectangle at index with every other rectangle it is cheap to
+*  merge with, until no such rectangle is left. A merge can make the grown
+*  rectangle cheap to merge with rectangles that were not before.
+******************************************************************************/
+static void coalesce(GLIB_DirtyRegion *pDirty, uint32_t index)
+{
+  uint32_t i;
+  uint32_t merged = 1;
+
+  while (merged)
+  {
+    merged = 0;
+    for (i = 0; i < pDirty->numRects; i++)
+    {
+      if (i == index) continue;
+
+      if (mergeWaste(&pDirty->rects[index], &pDirty->rects[i]) <= GLIB_DIRTY_MERGE_COST)
+      {
+        rectUnion(&pDirty->rects[index], &pDirty->rects[i], &pDirty->rects[index]);
+        removeRect(pDirty, i);
+
+        /* The last rectangle was moved into slot i */
+        if (index == pDirty->numRects) index = i;
+
+        merged = 1;
+        break;
+      }
+    }
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize an empty dirty region
+*
+*  @param pDirty
+*  Pointer to the GLIB_DirtyRegion to initialize
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_dirtyInit(GLIB_DirtyRegion *pDirty)
+{
+  /* Check arguments */
+  if (pDirty == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pDirty->numRects = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a rectangle to a dirty region
+*
+*  The rectangle is merged with the rectangles already in the region when
+*  the merge wastes at most GLIB_DIRTY_MERGE_COST pixels, so overlapping and
+*  adjacent rectangles end up as one. When the region is full, the two
+*  rectangles that are cheapest to merge are merged.
+*
+*  @param pDirty
+*  Pointer to the GLIB_DirtyRegion
+*  @param pRect
+*  Pointer to the rectangle that has changed
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_dirtyAdd(GLIB_DirtyRegion *pDirty, const GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pDirty == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_INVALID_ARGUMENT;
+
+  uint32_t i, j;
+
+  /* Nothing to do if the rectangle is already covered */
+  for (i = 0; i < pDirty->numRects; i++)
+  {
+    if ((pRect->xMin >= pDirty->rects[i].xMin) && (pRect->xMax <= pDirty->rects[i].xMax) &&
+        (pRect->yMin >= pDirty->rects[i].yMin) && (pRect->yMax <= pDirty->rects[i].yMax))
+    {
+      return GLIB_OK;
+    }
+  }
+
+  /* Make room by merging the cheapest pair when the region is full */
+  if (pDirty->numRects == GLIB_DIRTY_MAX_RECTS)
+  {
+    uint32_t bestWaste = 0xFFFFFFFF;
+    uint32_t bestI     = 0;
+    uint32_t bestJ     = 1;
+    uint32_t waste;
+
+    for (i = 0; i < pDirty->numRects; i++)
+    {
+      for (j = i + 1; j < pDirty->numRects; j++)
+      {
+        waste = mergeWaste(&pDirty->rects[i], &pDirty->rects[j]);
+        if (waste < bestWaste)
+        {
+          bestWaste = waste;
+          bestI     = i;
+          bestJ     = j;
+        }
+      }
+    }
+
+    rectUnion(&pDirty->rects[bestI], &pDirty->rects[bestJ], &pDirty->rects[bestI]);
+    removeRect(pDirty, bestJ);
+  }
+
+  pDirty->rects[pDirty->numRects] = *pRect;
+  pDirty->numRects++;
+
+  coalesce(pDirty, pDirty->numRects - 1);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Make the GLIB_Context record the areas it draws to in a dirty region
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pDirty
+*  Pointer to the dirty region, or NULL to stop tracking
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setDirtyRegion(GLIB_Context *pContext, GLIB_DirtyRegion *pDirty)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pContext->pDirty = pDirty;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Pushes the dirty rectangles of the GLIB_Context from its surface to the
+*  display, and empties the dirty region
+*
+*  @param pContext
+*  Pointer to a GLIB_Context with both a surface and a dirty region
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_flushDirty(const GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (pContext->pSurface == NULL || pContext->pDirty == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+  uint32_t i;
+
+  for (i = 0; i < pContext->pDirty->numRects; i++)
+  {
+    status = GLIB_flushSurface(pContext->pSurface, &pContext->pDirty->rects[i]);
+    if (status != GLIB_OK) return status;
+  }
+
+  pContext->pDirty->numRects = 0;
+
+  return GLIB_OK;
+}
@@ -0,0 +1,1160 @@
+ /*************************************************************************//**
+ * @file glib_displaylist.c
+ * @brief Energy Micro Graphics Library: Display Lists
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Command layout. Every command starts with an opcode word and a length
+ * word, which counts all words of the command. Draw commands continue with
+ * the distance back to the state command they were recorded with, their
+ * bounding box and then their arguments. */
+#define DL_HEADER_WORDS         2
+#define DL_STATE_WORDS          1
+#define DL_BOX_WORDS            4
+#define DL_ARGS_OFFSET          (DL_HEADER_WORDS + DL_STATE_WORDS + DL_BOX_WORDS)
+
+/* Replay order. One entry per draw command, holding its position in the
+ * buffer, kept at the end of the buffer and growing towards the commands.
+ * The first command to replay is in the last entry of the buffer. */
+#define DL_ORDER_WORDS          2
+
+/* State command: foreground color, background color and clipping region */
+#define DL_SET_STATE            0x01
+#define DL_SET_STATE_WORDS      (DL_HEADER_WORDS + 8)
+
+/* Draw commands */
+#define DL_CLEAR                0x10
+#define DL_PIXEL                0x11
+#define DL_LINE                 0x12
+#define DL_RECT                 0x13
+#define DL_RECT_FILLED          0x14
+#define DL_CIRCLE               0x15
+#define DL_CIRCLE_FILLED        0x16
+#define DL_PARTIAL_CIRCLE       0x17
+#define DL_POLYGON              0x18
+#define DL_STRING               0x19
+#define DL_BITMAP               0x1A
+#define DL_ARC                  0x1B
+#define DL_POLYGON_FILLED       0x1C
+#define DL_TRIANGLE_FILLED      0x1D
+#define DL_LINE_AA              0x1E
+
+/* Draw commands that are not limited by the clipping region */
+#define DL_IGNORES_CLIP(op)     ((op) == DL_CLEAR || (op) == DL_BITMAP)
+
+/* Maximum length of a command, given by the width of the length word */
+#define DL_MAX_WORDS            0xFFFF
+
+/* Local function prototypes */
+static uint32_t rectsIntersect(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB);
+static uint32_t intersectRect(GLIB_Rectangle *pRect, const GLIB_Rectangle *pWith);
+static void commandBox(const uint16_t *pCommand, GLIB_Rectangle *pBox);
+static uint32_t regionPushed(const GLIB_Context *pContext);
+static uint32_t orderEntry(const uint16_t *pEntry);
+static uint16_t *addCommand(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                            uint16_t opcode, uint32_t numArgs, GLIB_Rectangle *pBox);
+static EMSTATUS runCommand(GLIB_Context *pContext, const uint16_t *pCommand);
+static EMSTATUS recordLine(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                           uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                           uint16_t opcode);
+static EMSTATUS recordRect(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                           const GLIB_Rectangle *pRect, uint16_t opcode);
+static EMSTATUS recordCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                             uint16_t x, uint16_t y, uint16_t radius,
+                             uint16_t arg1, uint16_t arg2, uint16_t opcode);
+static EMSTATUS recordPolygon(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                              uint32_t numPoints, const uint16_t *polyPoints,
+                              uint32_t fillRule, uint16_t opcode);
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if the two rectangles have at least one pixel in common
+******************************************************************************/
+static uint32_t rectsIntersect(const GLIB_Rectangle *pA, const GLIB_Rectangle *pB)
+{
+  return (pA->xMin <= pB->xMax) && (pB->xMin <= pA->xMax) &&
+         (pA->yMin <= pB->yMax) && (pB->yMin <= pA->yMax);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Shrinks a rectangle to its intersection with another one
+*
+*  @return
+*  Returns 1 if the intersection is not empty, otherwise 0 and the rectangle
+*  is left unchanged
+******************************************************************************/
+static uint32_t intersectRect(GLIB_Rectangle *pRect, const GLIB_Rectangle *pWith)
+{
+  if (!rectsIntersect(pRect, pWith)) return 0;
+
+  if (pRect->xMin < pWith->xMin) pRect->xMin = pWith->xMin;
+  if (pRect->yMin < pWith->yMin) pRect->yMin = pWith->yMin;
+  if (pRect->xMax > pWith->xMax) pRect->xMax = pWith->xMax;
+  if (pRect->yMax > pWith->yMax) pRect->yMax = pWith->yMax;
+
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Reads the bounding box of a draw command
+******************************************************************************/
+static void commandBox(const uint16_t *pCommand, GLIB_Rectangle *pBox)
+{
+  pCommand += DL_HEADER_WORDS + DL_STATE_WORDS;
+
+  pBox->xMin = pCommand[0];
+  pBox->yMin = pCommand[1];
+  pBox->xMax = pCommand[2];
+  pBox->yMax = pCommand[3];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if a clip region of more than one rectangle is pushed. Only the
+*  clipping region of a command is recorded, so the region would be lost.
+******************************************************************************/
+static uint32_t regionPushed(const GLIB_Context *pContext)
+{
+  uint32_t numRects;
+
+  return GLIB_getClipRects(pContext, &numRects) != NULL;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the buffer position stored in an entry of the replay order
+******************************************************************************/
+static uint32_t orderEntry(const uint16_t *pEntry)
+{
+  return pEntry[0] | ((uint32_t) pEntry[1] << 16);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Appends a draw command, preceded by a state command if the recorded
+*  colors and clipping region differ from the context, and inserts it in
+*  the replay order
+*
+*  The command is moved ahead of earlier commands in raster order of the
+*  bounding boxes, but never past a command it overlaps, so the replay
+*  draws the same pixels as the recorded calls would.
+*
+*  @param pBox
+*  Bounding box of the command. It is clipped to the clipping region unless
+*  the command ignores it.
+*
+*  @return
+*  Returns a pointer to the argument words of the command, or NULL if the
+*  command is clipped away or does not fit in the buffer
+******************************************************************************/
+static uint16_t *addCommand(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                            uint16_t opcode, uint32_t numArgs, GLIB_Rectangle *pBox)
+{
+  uint32_t setState;
+  uint32_t length = DL_ARGS_OFFSET + numArgs;
+  uint32_t needed = length;
+  uint32_t pos, index;
+  uint16_t *pWord, *pOrder;
+  GLIB_Rectangle other;
+
+  if (!DL_IGNORES_CLIP(opcode) && !intersectRect(pBox, &pContext->clippingRegion))
+  {
+    return NULL;
+  }
+
+  /* The distance back to the state command must fit in one word */
+  setState = !pList->stateValid ||
+             (pList->foregroundColor != pContext->foregroundColor) ||
+             (pList->backgroundColor != pContext->backgroundColor) ||
+             (memcmp(&pList->clippingRegion, &pContext->clippingRegion,
+                     sizeof(GLIB_Rectangle)) != 0) ||
+             (pList->used - pList->statePos > DL_MAX_WORDS);
+
+  if (setState) needed += DL_SET_STATE_WORDS;
+
+  if ((length > DL_MAX_WORDS) ||
+      (pList->used + needed + DL_ORDER_WORDS * (pList->numCommands + 1) > pList->size))
+  {
+    return NULL;
+  }
+
+  pWord = pList->buffer + pList->used;
+
+  if (setState)
+  {
+    pList->statePos = pList->used;
+
+    *pWord++ = DL_SET_STATE;
+    *pWord++ = DL_SET_STATE_WORDS;
+    *pWord++ = pContext->foregroundColor & 0xFFFF;
+    *pWord++ = pContext->foregroundColor >> 16;
+    *pWord++ = pContext->backgroundColor & 0xFFFF;
+    *pWord++ = pContext->backgroundColor >> 16;
+    *pWord++ = pContext->clippingRegion.xMin;
+    *pWord++ = pContext->clippingRegion.yMin;
+    *pWord++ = pContext->clippingRegion.xMax;
+    *pWord++ = pContext->clippingRegion.yMax;
+
+    pList->foregroundColor = pContext->foregroundColor;
+    pList->backgroundColor = pContext->backgroundColor;
+    pList->clippingRegion  = pContext->clippingRegion;
+    pList->stateValid      = 1;
+  }
+
+  pos = pWord - pList->buffer;
+
+  *pWord++ = opcode;
+  *pWord++ = length;
+  *pWord++ = pos - pList->statePos;
+  *pWord++ = pBox->xMin;
+  *pWord++ = pBox->yMin;
+  *pWord++ = pBox->xMax;
+  *pWord++ = pBox->yMax;
+
+  /* Walk back through the replay order, moving later entries down one slot,
+   * until an earlier command overlaps this one or comes first in raster
+   * order */
+  pOrder = pList->buffer + pList->size - DL_ORDER_WORDS * (pList->numCommands + 1);
+
+  for (index = 0; index < pList->numCommands; index++)
+  {
+    commandBox(pList->buffer + orderEntry(&pOrder[DL_ORDER_WORDS * (index + 1)]), &other);
+
+    if (rectsIntersect(pBox, &other)) break;
+    if ((pBox->yMin > other.yMin) ||
+        ((pBox->yMin == other.yMin) && (pBox->xMin >= other.xMin))) break;
+
+    pOrder[DL_ORDER_WORDS * index]     = pOrder[DL_ORDER_WORDS * (index + 1)];
+    pOrder[DL_ORDER_WORDS * index + 1] = pOrder[DL_ORDER_WORDS * (index + 1) + 1];
+  }
+
+  pOrder[DL_ORDER_WORDS * index]     = pos & 0xFFFF;
+  pOrder[DL_ORDER_WORDS * index + 1] = pos >> 16;
+
+  pList->numCommands++;
+  pList->used += needed;
+
+  return pWord;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Executes one draw command with the colors and clipping region that are
+*  already set in the context
+******************************************************************************/
+static EMSTATUS runCommand(GLIB_Context *pContext, const uint16_t *pCommand)
+{
+  const uint16_t *pArgs = pCommand + DL_ARGS_OFFSET;
+  GLIB_Rectangle rect;
+  const uint8_t  *picData;
+
+  switch (pCommand[0])
+  {
+  case DL_CLEAR:
+    return GLIB_clear(pContext);
+
+  case DL_PIXEL:
+    return GLIB_drawPixel(pContext, pArgs[0], pArgs[1]);
+
+  case DL_LINE:
+    return GLIB_drawLine(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3]);
+
+  case DL_LINE_AA:
+    return GLIB_drawLineAA(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3]);
+
+  case DL_RECT:
+  case DL_RECT_FILLED:
+    rect.xMin = pArgs[0];
+    rect.yMin = pArgs[1];
+    rect.xMax = pArgs[2];
+    rect.yMax = pArgs[3];
+    if (pCommand[0] == DL_RECT) return GLIB_drawRect(pContext, &rect);
+    return GLIB_drawRectFilled(pContext, &rect);
+
+  case DL_CIRCLE:
+    return GLIB_drawCircle(pContext, pArgs[0], pArgs[1], pArgs[2]);
+
+  case DL_CIRCLE_FILLED:
+    return GLIB_drawCircleFilled(pContext, pArgs[0], pArgs[1], pArgs[2]);
+
+  case DL_PARTIAL_CIRCLE:
+    return GLIB_drawPartialCircle(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3]);
+
+  case DL_ARC:
+    return GLIB_drawArc(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3], pArgs[4]);
+
+  case DL_POLYGON:
+    return GLIB_drawPolygon(pContext, pArgs[0], (uint16_t *) &pArgs[1]);
+
+  case DL_POLYGON_FILLED:
+    return GLIB_drawPolygonFilled(pContext, pArgs[0], &pArgs[2], pArgs[1]);
+
+  case DL_TRIANGLE_FILLED:
+    return GLIB_drawTriangleFilled(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3],
+                                   pArgs[4], pArgs[5]);
+
+  case DL_STRING:
+    return GLIB_drawString(pContext, (char *) &pArgs[4], pArgs[3],
+                           pArgs[0], pArgs[1], pArgs[2]);
+
+  case DL_BITMAP:
+    memcpy(&picData, &pArgs[4], sizeof(picData));
+    return GLIB_drawBitmap(pContext, pArgs[0], pArgs[1], pArgs[2], pArgs[3],
+                           (uint8_t *) picData);
+
+  default:
+    return GLIB_INVALID_ARGUMENT;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize an empty display list on top of a command buffer
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList to initialize
+*  @param buffer
+*  Command buffer. The end of the buffer also holds the replay order, two
+*  words per draw command.
+*  @param size
+*  Size of the buffer in 16-bit words
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_displayListInit(GLIB_DisplayList *pList, uint16_t *buffer, uint32_t size)
+{
+  /* Check arguments */
+  if (pList == NULL || buffer == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pList->buffer = buffer;
+  pList->size   = size;
+
+  return GLIB_displayListReset(pList);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Removes all commands from a display list, so a new frame can be recorded
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_displayListReset(GLIB_DisplayList *pList)
+{
+  /* Check arguments */
+  if (pList == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pList->used        = 0;
+  pList->numCommands = 0;
+  pList->statePos    = 0;
+  pList->stateValid  = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes a checksum of the recorded commands
+*
+*  Two lists that record the same draw calls have the same checksum, so an
+*  application that records every frame can skip the replay when the
+*  checksum has not changed since the last frame. Bitmaps are recorded by
+*  reference, so changes to the pixel data of a bitmap are not seen.
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*
+*  @return
+*  Returns the 32-bit FNV-1a hash of the commands
+******************************************************************************/
+uint32_t GLIB_displayListChecksum(const GLIB_DisplayList *pList)
+{
+  uint32_t hash = 2166136261u;
+  uint32_t i;
+
+  if (pList == NULL) return 0;
+
+  for (i = 0; i < pList->used; i++)
+  {
+    hash = (hash ^ (pList->buffer[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (pList->buffer[i] >> 8)) * 16777619u;
+  }
+
+  return hash;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Replays a display list
+*
+*  Commands are executed in the order set up while recording: in raster
+*  order of their bounding boxes where that cannot change the result, as a
+*  command is only moved ahead of earlier commands it does not overlap.
+*  Consecutive commands then tend to continue where the previous one left
+*  the display, and commands outside the clipping region of the context
+*  (and outside its surface, if any) are skipped without being decoded.
+*  The recorded clipping regions are narrowed to the clipping region of the
+*  context. The list itself is not modified.
+*
+*  The signature matches GLIB_DrawFunction, so a display list can be passed
+*  to GLIB_renderBands() directly.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context to draw in. Its colors and clipping region
+*  are restored on return.
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_displayListDraw(GLIB_Context *pContext, void *pList)
+{
+  /* Check arguments */
+  if (pContext == NULL || pList == NULL) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_DisplayList *pDisplayList = (const GLIB_DisplayList *) pList;
+  const uint16_t *buffer       = pDisplayList->buffer;
+  const uint16_t *pOrder       = buffer + pDisplayList->size;
+  const uint16_t *pCommand;
+  const uint16_t *pState       = NULL;
+  EMSTATUS       status          = GLIB_OK;
+  uint32_t       savedForeground = pContext->foregroundColor;
+  uint32_t       savedBackground = pContext->backgroundColor;
+  GLIB_Rectangle savedClip       = pContext->clippingRegion;
+  GLIB_Rectangle area, box, clip;
+  uint32_t       index, clipValid = 0;
+
+  /* Area that can change at all */
+  if (pContext->pSurface != NULL)
+  {
+    area = pContext->pSurface->area;
+  }
+  else
+  {
+    area.xMin = 0;
+    area.yMin = 0;
+    area.xMax = pContext->pDisplayGeometry->xSize - 1;
+    area.yMax = pContext->pDisplayGeometry->ySize - 1;
+  }
+
+  for (index = 0; (index < pDisplayList->numCommands) && (status == GLIB_OK); index++)
+  {
+    pOrder  -= DL_ORDER_WORDS;
+    pCommand = buffer + orderEntry(pOrder);
+    commandBox(pCommand, &box);
+
+    /* Skip commands that cannot change anything */
+    if (!rectsIntersect(&box, &area) ||
+        (!DL_IGNORES_CLIP(pCommand[0]) && !rectsIntersect(&box, &savedClip)))
+    {
+      continue;
+    }
+
+    /* Set up the state the command was recorded with */
+    if (pCommand - pCommand[DL_HEADER_WORDS] != pState)
+    {
+      pState = pCommand - pCommand[DL_HEADER_WORDS];
+
+      GLIB_setForegroundColor(pContext, pState[2] | ((uint32_t) pState[3] << 16));
+      GLIB_setBackgroundColor(pContext, pState[4] | ((uint32_t) pState[5] << 16));
+
+      clip.xMin = pState[6];
+      clip.yMin = pState[7];
+      clip.xMax = pState[8];
+      clip.yMax = pState[9];
+
+      pContext->clippingRegion = savedClip;
+      clipValid = intersectRect(&pContext->clippingRegion, &clip);
+    }
+
+    if (!clipValid) continue;
+
+    status = runCommand(pContext, pCommand);
+    if (status == GLIB_DID_NOT_DRAW) status = GLIB_OK;
+  }
+
+  GLIB_setForegroundColor(pContext, savedForeground);
+  GLIB_setBackgroundColor(pContext, savedBackground);
+  pContext->clippingRegion  = savedClip;
+
+  return status;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_clear()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListClear(GLIB_DisplayList *pList, const GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  GLIB_Rectangle box = { 0, 0, pContext->pDisplayGeometry->xSize - 1,
+                         pContext->pDisplayGeometry->ySize - 1 };
+
+  if (addCommand(pList, pContext, DL_CLEAR, 0, &box) == NULL) return GLIB_OUT_OF_MEMORY;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawPixel()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  X-coordinate
+*  @param y
+*  Y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the pixel is outside the
+*  clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawPixel(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                   uint16_t x, uint16_t y)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  GLIB_Rectangle box = { x, y, x, y };
+  uint16_t       *pArgs;
+
+  if (!rectsIntersect(&box, &pContext->clippingRegion)) return GLIB_DID_NOT_DRAW;
+
+  pArgs = addCommand(pList, pContext, DL_PIXEL, 2, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = x;
+  pArgs[1] = y;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawLine()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param x2
+*  End x-coordinate
+*  @param y2
+*  End y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the line is outside the
+*  clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawLine(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                  uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  return recordLine(pList, pContext, x1, y1, x2, y2, DL_LINE);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawLineAA()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param x2
+*  End x-coordinate
+*  @param y2
+*  End y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the line is outside the
+*  clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawLineAA(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  return recordLine(pList, pContext, x1, y1, x2, y2, DL_LINE_AA);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawLine() or GLIB_drawLineAA()
+******************************************************************************/
+static EMSTATUS recordLine(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                           uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                           uint16_t opcode)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  GLIB_Rectangle box;
+  uint16_t       *pArgs;
+
+  box.xMin = (x1 < x2) ? x1 : x2;
+  box.xMax = (x1 < x2) ? x2 : x1;
+  box.yMin = (y1 < y2) ? y1 : y2;
+  box.yMax = (y1 < y2) ? y2 : y1;
+  if (!rectsIntersect(&box, &pContext->clippingRegion)) return GLIB_DID_NOT_DRAW;
+
+  pArgs = addCommand(pList, pContext, opcode, 4, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = x1;
+  pArgs[1] = y1;
+  pArgs[2] = x2;
+  pArgs[3] = y2;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawRect() or GLIB_drawRectFilled()
+******************************************************************************/
+static EMSTATUS recordRect(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                           const GLIB_Rectangle *pRect, uint16_t opcode)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  GLIB_Rectangle box = *pRect;
+  uint16_t       *pArgs;
+
+  GLIB_normalizeRect(&box);
+  if (!rectsIntersect(&box, &pContext->clippingRegion)) return GLIB_DID_NOT_DRAW;
+
+  pArgs = addCommand(pList, pContext, opcode, 4, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = pRect->xMin;
+  pArgs[1] = pRect->yMin;
+  pArgs[2] = pRect->xMax;
+  pArgs[3] = pRect->yMax;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawRect()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param pRect
+*  Pointer to a rectangle structure
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the rectangle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawRect(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                  const GLIB_Rectangle *pRect)
+{
+  return recordRect(pList, pContext, pRect, DL_RECT);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawRectFilled()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param pRect
+*  Pointer to a rectangle structure
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the rectangle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawRectFilled(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                        const GLIB_Rectangle *pRect)
+{
+  return recordRect(pList, pContext, pRect, DL_RECT_FILLED);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawCircle(), GLIB_drawCircleFilled(),
+*  GLIB_drawPartialCircle() or GLIB_drawArc(), with up to two arguments
+*  after the radius
+******************************************************************************/
+static EMSTATUS recordCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                             uint16_t x, uint16_t y, uint16_t radius,
+                             uint16_t arg1, uint16_t arg2, uint16_t opcode)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  GLIB_Rectangle box;
+  uint16_t       *pArgs;
+  uint32_t       numArgs = 3;
+
+  if (opcode == DL_PARTIAL_CIRCLE) numArgs = 4;
+  if (opcode == DL_ARC) numArgs = 5;
+
+  box.xMin = (x > radius) ? x - radius : 0;
+  box.yMin = (y > radius) ? y - radius : 0;
+  box.xMax = ((uint32_t) x + radius > 0xFFFF) ? 0xFFFF : x + radius;
+  box.yMax = ((uint32_t) y + radius > 0xFFFF) ? 0xFFFF : y + radius;
+  if (!rectsIntersect(&box, &pContext->clippingRegion)) return GLIB_DID_NOT_DRAW;
+
+  pArgs = addCommand(pList, pContext, opcode, numArgs, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = x;
+  pArgs[1] = y;
+  pArgs[2] = radius;
+  if (numArgs > 3) pArgs[3] = arg1;
+  if (numArgs > 4) pArgs[4] = arg2;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawCircle()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  Center x-coordinate
+*  @param y
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the circle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x, uint16_t y, uint16_t radius)
+{
+  return recordCircle(pList, pContext, x, y, radius, 0, 0, DL_CIRCLE);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawCircleFilled()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  Center x-coordinate
+*  @param y
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the circle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawCircleFilled(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                          uint16_t x, uint16_t y, uint16_t radius)
+{
+  return recordCircle(pList, pContext, x, y, radius, 0, 0, DL_CIRCLE_FILLED);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawPartialCircle()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  Center x-coordinate
+*  @param y
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*  @param bitMask
+*  Bitmask which decides which octants pixels should be drawn
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the circle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawPartialCircle(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                           uint16_t x, uint16_t y, uint16_t radius,
+                                           uint8_t bitMask)
+{
+  return recordCircle(pList, pContext, x, y, radius, bitMask, 0, DL_PARTIAL_CIRCLE);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawArc()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  Center x-coordinate
+*  @param y
+*  Center y-coordinate
+*  @param radius
+*  Radius of the circle
+*  @param startAngle
+*  Angle where the arc starts, in degrees counterclockwise from the right
+*  @param endAngle
+*  Angle where the arc ends
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the circle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawArc(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                 uint16_t x, uint16_t y, uint16_t radius,
+                                 uint16_t startAngle, uint16_t endAngle)
+{
+  return recordCircle(pList, pContext, x, y, radius, startAngle, endAngle, DL_ARC);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawPolygon(), GLIB_drawPolygonFilled() or
+*  GLIB_drawTriangleFilled(). The points are copied into the list, after the
+*  number of points and the fill rule. A triangle only has the points.
+******************************************************************************/
+static EMSTATUS recordPolygon(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                              uint32_t numPoints, const uint16_t *polyPoints,
+                              uint32_t fillRule, uint16_t opcode)
+{
+  GLIB_Rectangle box = { polyPoints[0], polyPoints[1], polyPoints[0], polyPoints[1] };
+  uint16_t       *pArgs;
+  uint32_t       numHeader = 1;
+  uint32_t       i;
+
+  if (opcode == DL_POLYGON_FILLED) numHeader = 2;
+  if (opcode == DL_TRIANGLE_FILLED) numHeader = 0;
+
+  for (i = 1; i < numPoints; i++)
+  {
+    if (polyPoints[2 * i] < box.xMin) box.xMin = polyPoints[2 * i];
+    if (polyPoints[2 * i] > box.xMax) box.xMax = polyPoints[2 * i];
+    if (polyPoints[2 * i + 1] < box.yMin) box.yMin = polyPoints[2 * i + 1];
+    if (polyPoints[2 * i + 1] > box.yMax) box.yMax = polyPoints[2 * i + 1];
+  }
+  if (!rectsIntersect(&box, &pContext->clippingRegion)) return GLIB_DID_NOT_DRAW;
+  if (numPoints > (DL_MAX_WORDS - numHeader) / 2) return GLIB_OUT_OF_MEMORY;
+
+  pArgs = addCommand(pList, pContext, opcode, numHeader + 2 * numPoints, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  if (numHeader > 0) pArgs[0] = numPoints;
+  if (numHeader > 1) pArgs[1] = fillRule;
+  memcpy(&pArgs[numHeader], polyPoints, 2 * numPoints * sizeof(uint16_t));
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawPolygon(). The points are copied into the list.
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param numPoints
+*  Number of points in the polygon
+*  @param polyPoints
+*  Polygon points, organized as { x1, y1, x2, y2 ... }
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the polygon is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawPolygon(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                     uint32_t numPoints, const uint16_t *polyPoints)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL || polyPoints == NULL || numPoints < 2)
+    return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  return recordPolygon(pList, pContext, numPoints, polyPoints, 0, DL_POLYGON);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawPolygonFilled(). The points are copied into the list.
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param numPoints
+*  Number of points in the polygon
+*  @param polyPoints
+*  Polygon points, organized as { x1, y1, x2, y2 ... }
+*  @param fillRule
+*  GLIB_FILL_EVEN_ODD or GLIB_FILL_NON_ZERO
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the polygon is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawPolygonFilled(GLIB_DisplayList *pList,
+                                           const GLIB_Context *pContext,
+                                           uint32_t numPoints, const uint16_t *polyPoints,
+                                           uint32_t fillRule)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL || polyPoints == NULL || numPoints < 3)
+    return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  return recordPolygon(pList, pContext, numPoints, polyPoints, fillRule, DL_POLYGON_FILLED);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawTriangleFilled()
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x0
+*  x-coordinate of the first corner
+*  @param y0
+*  y-coordinate of the first corner
+*  @param x1
+*  x-coordinate of the second corner
+*  @param y1
+*  y-coordinate of the second corner
+*  @param x2
+*  x-coordinate of the third corner
+*  @param y2
+*  y-coordinate of the third corner
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the triangle is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawTriangleFilled(GLIB_DisplayList *pList,
+                                            const GLIB_Context *pContext,
+                                            uint16_t x0, uint16_t y0, uint16_t x1,
+                                            uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  uint16_t points[6] = { x0, y0, x1, y1, x2, y2 };
+
+  return recordPolygon(pList, pContext, 3, points, 0, DL_TRIANGLE_FILLED);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawString(). The characters are copied into the list.
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param pString
+*  Pointer to the string
+*  @param sLength
+*  Number of characters in the string
+*  @param x0
+*  Start x-coordinate for the string (Upper left corner)
+*  @param y0
+*  Start y-coordinate for the string (Upper left corner)
+*  @param opaque
+*  If opaque == 1, the background color is used behind the characters
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the string is outside
+*  the clipping region, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawString(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    const char *pString, uint16_t sLength,
+                                    uint16_t x0, uint16_t y0, uint32_t opaque)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL || pString == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+
+  /* The box covers the cells of the chars. A string with invalid chars can
+   * reach down and right to the end of the clipping region. */
+  GLIB_Rectangle box = { x0, y0, pContext->clippingRegion.xMax, pContext->clippingRegion.yMax };
+  uint16_t       *pArgs;
+  uint16_t       width, height;
+
+  if (GLIB_measureString(NULL, pString, sLength, &width, &height) == GLIB_OK)
+  {
+    if (width == 0) return GLIB_DID_NOT_DRAW;
+
+    box.xMax = (x0 + width - 1 > 0xFFFF) ? 0xFFFF : x0 + width - 1;
+    box.yMax = (y0 + height - 1 > 0xFFFF) ? 0xFFFF : y0 + height - 1;
+  }
+  else if ((x0 > box.xMax) || (y0 > box.yMax))
+  {
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  pArgs = addCommand(pList, pContext, DL_STRING, 4 + (sLength + 1) / 2, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = x0;
+  pArgs[1] = y0;
+  pArgs[2] = opaque;
+  pArgs[3] = sLength;
+
+  /* Clear the pad byte of an odd length, so it does not change the checksum */
+  if (sLength > 0) pArgs[4 + (sLength - 1) / 2] = 0;
+  memcpy(&pArgs[4], pString, sLength);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records GLIB_drawBitmap(). The pixel data is not copied, so it must stay
+*  valid for as long as the list is replayed.
+*
+*  @param pList
+*  Pointer to the GLIB_DisplayList
+*  @param pContext
+*  Pointer to the GLIB_Context whose colors and clipping region are recorded
+*  @param x
+*  Start x-coordinate for bitmap
+*  @param y
+*  Start y-coordinate for bitmap
+*  @param width
+*  Width of picture
+*  @param height
+*  Height of picture
+*  @param picData
+*  Bitmap data 24-bit RGB
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_OUT_OF_MEMORY if the list is full, or
+*  GLIB_INVALID_CLIPPINGREGION if a clip region is pushed
+******************************************************************************/
+EMSTATUS GLIB_displayListDrawBitmap(GLIB_DisplayList *pList, const GLIB_Context *pContext,
+                                    uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                    const uint8_t *picData)
+{
+  /* Check arguments */
+  if (pList == NULL || pContext == NULL || picData == NULL) return GLIB_INVALID_ARGUMENT;
+  if (regionPushed(pContext)) return GLIB_INVALID_CLIPPINGREGION;
+  if (width == 0 || height == 0) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle box = { x, y, x + width - 1, y + height - 1 };
+  uint16_t       *pArgs;
+
+  if (box.xMax < x) box.xMax = 0xFFFF;
+  if (box.yMax < y) box.yMax = 0xFFFF;
+
+  pArgs = addCommand(pList, pContext, DL_BITMAP,
+                     4 + (sizeof(picData) + 1) / 2, &box);
+  if (pArgs == NULL) return GLIB_OUT_OF_MEMORY;
+
+  pArgs[0] = x;
+  pArgs[1] = y;
+  pArgs[2] = width;
+  pArgs[3] = height;
+  memcpy(&pArgs[4], &picData, sizeof(picData));
+
+  return GLIB_OK;
+}
@@ -0,0 +1,654 @@
+ /*************************************************************************//**
+ * @file glib_font.c
+ * @brief Energy Micro Graphics Library: Proportional Fonts
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Number of pixels of an opaque 4 bits per pixel glyph row that are
+ * converted and written in one burst */
+#define COVERAGE_CHUNK          32
+
+/* Local function prototypes */
+static EMSTATUS fillRect(const GLIB_Context *pContext, int32_t x, int32_t y,
+                         int32_t width, int32_t height, uint32_t color);
+static EMSTATUS drawCoverage(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                             const GLIB_Glyph *pGlyph, int32_t glyphX, int32_t glyphY,
+                             uint32_t opaque, const uint32_t *pRamp);
+static EMSTATUS drawGlyph(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                          const GLIB_Glyph *pGlyph, int32_t x, int32_t y,
+                          uint32_t opaque, const uint32_t *pRamp);
+static const uint32_t *getRamp(const GLIB_Context *pContext, GLIB_BlendRamp *pLocal);
+static uint32_t blendColor(uint32_t foregroundColor, uint32_t backgroundColor, uint32_t alpha);
+static EMSTATUS fillCell(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                         const GLIB_Glyph *pGlyph, int32_t x, int32_t y);
+static const uint16_t *cachedGlyph(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                                   const GLIB_Glyph *pGlyph);
+
+/**************************************************************************//**
+*  @brief
+*  Fills the part of a rectangle that is inside the clipping region
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_DID_NOT_DRAW if the rectangle is outside
+*  the clipping region, or else error code
+******************************************************************************/
+static EMSTATUS fillRect(const GLIB_Context *pContext, int32_t x, int32_t y,
+                         int32_t width, int32_t height, uint32_t color)
+{
+  int32_t xEnd = x + width - 1;
+  int32_t yEnd = y + height - 1;
+
+  if (x < pContext->clippingRegion.xMin) x = pContext->clippingRegion.xMin;
+  if (y < pContext->clippingRegion.yMin) y = pContext->clippingRegion.yMin;
+  if (xEnd > pContext->clippingRegion.xMax) xEnd = pContext->clippingRegion.xMax;
+  if (yEnd > pContext->clippingRegion.yMax) yEnd = pContext->clippingRegion.yMax;
+
+  if ((x > xEnd) || (y > yEnd)) return GLIB_DID_NOT_DRAW;
+
+  return GLIB_writeColor(pContext, x, y, xEnd - x + 1, yEnd - y + 1, color);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the rows of a 4 bits per pixel glyph. Opaque rows are looked up in
+*  the blend ramp and written in bursts of up to COVERAGE_CHUNK pixels.
+*  Without opaque, the display
+*  cannot be read back for blending, so pixels with at least half coverage
+*  are drawn as spans of the foreground color.
+******************************************************************************/
+static EMSTATUS drawCoverage(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                             const GLIB_Glyph *pGlyph, int32_t glyphX, int32_t glyphY,
+                             uint32_t opaque, const uint32_t *pRamp)
+{
+  EMSTATUS      status;
+  const uint8_t *pRow;
+  uint32_t      rowBytes = (pGlyph->width + 1) / 2;
+  uint32_t      pixels[COVERAGE_CHUNK];
+  uint32_t      coverage;
+  int32_t       rowMin, rowMax, colMin, colMax, row, col, chunkEnd, runStart;
+
+  /* Part of the glyph that is inside the clipping region */
+  colMin = pContext->clippingRegion.xMin - glyphX;
+  rowMin = pContext->clippingRegion.yMin - glyphY;
+  colMax = pContext->clippingRegion.xMax - glyphX;
+  rowMax = pContext->clippingRegion.yMax - glyphY;
+  if (colMin < 0) colMin = 0;
+  if (rowMin < 0) rowMin = 0;
+  if (colMax > pGlyph->width - 1) colMax = pGlyph->width - 1;
+  if (rowMax > pGlyph->height - 1) rowMax = pGlyph->height - 1;
+
+  /* The glyph can be outside the clipping region while its cell is not */
+  if ((colMin > colMax) || (rowMin > rowMax)) return GLIB_OK;
+
+  for (row = rowMin; row <= rowMax; row++)
+  {
+    pRow = pFont->pData + pGlyph->offset + row * rowBytes;
+
+    if (opaque == 1)
+    {
+      for (runStart = colMin; runStart <= colMax; runStart = chunkEnd + 1)
+      {
+        chunkEnd = runStart + COVERAGE_CHUNK - 1;
+        if (chunkEnd > colMax) chunkEnd = colMax;
+
+        for (col = runStart; col <= chunkEnd; col++)
+        {
+          coverage               = (pRow[col >> 1] >> ((col & 1) * 4)) & 0xF;
+          pixels[col - runStart] = pRamp[coverage];
+        }
+
+        status = GLIB_writeDataNative(pContext, glyphX + runStart, glyphY + row,
+                                      chunkEnd - runStart + 1, 1, pixels);
+        if (status != GLIB_OK) return status;
+      }
+      continue;
+    }
+
+    runStart = -1;
+    for (col = colMin; col <= colMax + 1; col++)
+    {
+      coverage = (col <= colMax) ? (pRow[col >> 1] >> ((col & 1) * 4)) & 0xF : 0;
+      if ((coverage >= GLIB_BLEND_RAMP_SIZE / 2) && (runStart < 0))
+      {
+        runStart = col;
+      }
+      else if ((coverage < GLIB_BLEND_RAMP_SIZE / 2) && (runStart >= 0))
+      {
+        status = fillRect(pContext, glyphX + runStart, glyphY + row, col - runStart, 1,
+                          pContext->foregroundColor);
+        if (status != GLIB_OK) return status;
+        runStart = -1;
+      }
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the blend ramp for the colors of a GLIB_Context, from the glyph cache
+*  if the context has one, or else computed into pLocal
+******************************************************************************/
+static const uint32_t *getRamp(const GLIB_Context *pContext, GLIB_BlendRamp *pLocal)
+{
+  if (pContext->pGlyphCache != NULL)
+  {
+    return GLIB_glyphCacheRamp(pContext->pGlyphCache, pContext);
+  }
+
+  GLIB_blendRampInit(pLocal, pContext);
+  return pLocal->colors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Blends two 24-bit colors, alpha going from 0 for the background to
+*  GLIB_BLEND_RAMP_SIZE - 1 for the foreground
+******************************************************************************/
+static uint32_t blendColor(uint32_t foregroundColor, uint32_t backgroundColor, uint32_t alpha)
+{
+  uint8_t  fgRed, fgGreen, fgBlue;
+  uint8_t  bgRed, bgGreen, bgBlue;
+  uint32_t red, green, blue;
+  uint32_t max = GLIB_BLEND_RAMP_SIZE - 1;
+
+  GLIB_colorTranslate24bpp(foregroundColor, &fgRed, &fgGreen, &fgBlue);
+  GLIB_colorTranslate24bpp(backgroundColor, &bgRed, &bgGreen, &bgBlue);
+
+  red   = (fgRed * alpha + bgRed * (max - alpha) + max / 2) / max;
+  green = (fgGreen * alpha + bgGreen * (max - alpha) + max / 2) / max;
+  blue  = (fgBlue * alpha + bgBlue * (max - alpha) + max / 2) / max;
+
+  return GLIB_rgbColor(red, green, blue);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills the part of the character cell at x, y that is outside the glyph
+*  box with the background: the rows above and below the glyph and the
+*  columns to its left and right
+******************************************************************************/
+static EMSTATUS fillCell(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                         const GLIB_Glyph *pGlyph, int32_t x, int32_t y)
+{
+  EMSTATUS status;
+  int32_t  glyphX   = x + pGlyph->xOffset;
+  int32_t  glyphY   = y + pGlyph->yOffset;
+  int32_t  cellXEnd = x + pGlyph->advance;
+  int32_t  cellYEnd = y + pFont->height;
+  int32_t  inkXEnd  = glyphX + pGlyph->width;
+  int32_t  inkYEnd  = glyphY + pGlyph->height;
+  int32_t  left     = (glyphX < cellXEnd) ? glyphX : cellXEnd;
+  int32_t  right    = (inkXEnd > x) ? inkXEnd : x;
+  int32_t  top      = (glyphY < cellYEnd) ? glyphY : cellYEnd;
+  int32_t  bottom   = (inkYEnd > y) ? inkYEnd : y;
+  int32_t  inkYMin  = (glyphY > y) ? glyphY : y;
+  int32_t  inkYMax  = (inkYEnd < cellYEnd) ? inkYEnd - 1 : cellYEnd - 1;
+
+  status = fillRect(pContext, x, y, pGlyph->advance, top - y, pContext->backgroundColor);
+  if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+
+  status = fillRect(pContext, x, bottom, pGlyph->advance, cellYEnd - bottom,
+                    pContext->backgroundColor);
+  if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+
+  status = fillRect(pContext, x, inkYMin, left - x, inkYMax - inkYMin + 1,
+                    pContext->backgroundColor);
+  if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+
+  status = fillRect(pContext, right, inkYMin, cellXEnd - right, inkYMax - inkYMin + 1,
+                    pContext->backgroundColor);
+  if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the opaque glyph box from the glyph cache of the context, rendering
+*  it into the cache first if it is not there
+*
+*  @return
+*  Returns the RGB565 pixels of the glyph box, or NULL if the context has no
+*  glyph cache or the glyph box does not fit in an entry
+******************************************************************************/
+static const uint16_t *cachedGlyph(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                                   const GLIB_Glyph *pGlyph)
+{
+  const uint16_t *pCached;
+  uint16_t       *pPixels;
+  uint16_t       glyph = pGlyph - pFont->pGlyphs;
+  uint32_t       total = (uint32_t) pGlyph->width * pGlyph->height;
+  uint32_t       pixel, run, set;
+
+  if ((pContext->pGlyphCache == NULL) || (total == 0) ||
+      (total > GLIB_GLYPH_CACHE_MAX_PIXELS))
+  {
+    return NULL;
+  }
+
+  pCached = GLIB_glyphCacheLookup(pContext->pGlyphCache, pFont, glyph,
+                                  pContext->foregroundColor, pContext->backgroundColor);
+  if (pCached != NULL) return pCached;
+
+  pPixels = GLIB_glyphCacheInsert(pContext->pGlyphCache, pFont, glyph,
+                                  pContext->foregroundColor, pContext->backgroundColor);
+
+  if (pFont->bitsPerPixel == 4)
+  {
+    const uint8_t *pRow;
+    uint16_t      ramp[GLIB_BLEND_RAMP_SIZE];
+    uint32_t      rowBytes = (pGlyph->width + 1) / 2;
+    uint32_t      row, col;
+
+    for (run = 0; run < GLIB_BLEND_RAMP_SIZE; run++)
+    {
+      ramp[run] = GLIB_colorTranslateRGB565(blendColor(pContext->foregroundColor,
+                                                       pContext->backgroundColor, run));
+    }
+
+    pixel = 0;
+    for (row = 0; row < pGlyph->height; row++)
+    {
+      pRow = pFont->pData + pGlyph->offset + row * rowBytes;
+      for (col = 0; col < pGlyph->width; col++)
+      {
+        pPixels[pixel++] = ramp[(pRow[col >> 1] >> ((col & 1) * 4)) & 0xF];
+      }
+    }
+  }
+  else
+  {
+    /* The runs alternate between background and foreground pixels */
+    uint16_t      foreground = GLIB_colorTranslateRGB565(pContext->foregroundColor);
+    uint16_t      background = GLIB_colorTranslateRGB565(pContext->backgroundColor);
+    const uint8_t *pRun      = pFont->pData + pGlyph->offset;
+
+    for (pixel = 0, set = 0; pixel < total; set ^= 1)
+    {
+      run = *pRun++;
+      if (run > total - pixel) run = total - pixel;
+
+      while (run-- > 0) pPixels[pixel++] = set ? foreground : background;
+    }
+  }
+
+  return pPixels;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a glyph with its character cell at x, y. Opaque glyphs come from
+*  the glyph cache of the context when it can hold them. Otherwise each row
+*  of a run of set pixels is written as one span. pRamp is only used for
+*  opaque 4 bits per pixel glyphs.
+******************************************************************************/
+static EMSTATUS drawGlyph(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                          const GLIB_Glyph *pGlyph, int32_t x, int32_t y,
+                          uint32_t opaque, const uint32_t *pRamp)
+{
+  EMSTATUS       status;
+  const uint16_t *pCached;
+  int32_t        xMin, yMin, xMax, yMax;
+  int32_t        glyphX = x + pGlyph->xOffset;
+  int32_t        glyphY = y + pGlyph->yOffset;
+
+  /* Bounding box of everything that is drawn */
+  xMin = glyphX;
+  yMin = glyphY;
+  xMax = glyphX + pGlyph->width - 1;
+  yMax = glyphY + pGlyph->height - 1;
+  if (opaque == 1)
+  {
+    if (x < xMin) xMin = x;
+    if (y < yMin) yMin = y;
+    if (x + pGlyph->advance - 1 > xMax) xMax = x + pGlyph->advance - 1;
+    if (y + pFont->height - 1 > yMax) yMax = y + pFont->height - 1;
+  }
+
+  /* Check against clipping region */
+  if ((xMin > pContext->clippingRegion.xMax) || (yMin > pContext->clippingRegion.yMax) ||
+      (xMax < pContext->clippingRegion.xMin) || (yMax < pContext->clippingRegion.yMin) ||
+      (xMin > xMax) || (yMin > yMax))
+  {
+    /* Do not draw if the char is outside of clipping region */
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Opaque glyphs with their glyph box inside the clipping region are drawn
+   * from the glyph cache, with no decoding */
+  if ((opaque == 1) &&
+      (glyphX >= pContext->clippingRegion.xMin) && (glyphY >= pContext->clippingRegion.yMin) &&
+      (glyphX + pGlyph->width - 1 <= pContext->clippingRegion.xMax) &&
+      (glyphY + pGlyph->height - 1 <= pContext->clippingRegion.yMax))
+  {
+    pCached = cachedGlyph(pContext, pFont, pGlyph);
+    if (pCached != NULL)
+    {
+      status = fillCell(pContext, pFont, pGlyph, x, y);
+      if (status != GLIB_OK) return status;
+
+      return GLIB_writeDataRGB565(pContext, glyphX, glyphY, pGlyph->width, pGlyph->height,
+                                  pCached);
+    }
+  }
+
+  if (pFont->bitsPerPixel == 4)
+  {
+    /* Opaque coverage rows write every pixel of the glyph box, so only the
+     * rest of the character cell is filled with the background */
+    if (opaque == 1)
+    {
+      status = fillCell(pContext, pFont, pGlyph, x, y);
+      if (status != GLIB_OK) return status;
+    }
+
+    return drawCoverage(pContext, pFont, pGlyph, glyphX, glyphY, opaque, pRamp);
+  }
+
+  /* Fill the character cell with the background, the set pixels are drawn
+   * on top of it */
+  if (opaque == 1)
+  {
+    status = fillRect(pContext, x, y, pGlyph->advance, pFont->height,
+                      pContext->backgroundColor);
+    if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+  }
+
+  const uint8_t *pRun  = pFont->pData + pGlyph->offset;
+  uint32_t      total  = (uint32_t) pGlyph->width * pGlyph->height;
+  uint32_t      pixel  = 0;
+  uint32_t      set    = 0;
+  uint32_t      run, row, col, length;
+
+  while (pixel < total)
+  {
+    run = *pRun++;
+
+    if (set)
+    {
+      row = pixel / pGlyph->width;
+      col = pixel % pGlyph->width;
+
+      /* Stop when the rest of the glyph is below the clipping region */
+      if (glyphY + (int32_t) row > pContext->clippingRegion.yMax) break;
+
+      pixel += run;
+      while (run > 0)
+      {
+        /* Split the run at the end of each row */
+        length = pGlyph->width - col;
+        if (length > run) length = run;
+
+        status = fillRect(pContext, glyphX + col, glyphY + row, length, 1,
+                          pContext->foregroundColor);
+        if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+
+        run -= length;
+        col  = 0;
+        row++;
+      }
+    }
+    else
+    {
+      pixel += run;
+    }
+
+    set ^= 1;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Finds the glyph of a character
+*
+*  @param pFont
+*  Pointer to the font
+*  @param myChar
+*  Character to look up
+*
+*  @return
+*  Returns a pointer to the glyph, or NULL if the font has no glyph for the
+*  character
+******************************************************************************/
+const GLIB_Glyph *GLIB_fontGlyph(const GLIB_Font *pFont, char myChar)
+{
+  uint8_t code = (uint8_t) myChar;
+
+  if (pFont == NULL) return NULL;
+  if ((code < pFont->firstChar) || (code > pFont->lastChar)) return NULL;
+
+  return &pFont->pGlyphs[code - pFont->firstChar];
+}
+
+/**************************************************************************//**
+*  @brief
+*  Finds the kerning between two characters
+*
+*  @param pFont
+*  Pointer to the font
+*  @param left
+*  Left character
+*  @param right
+*  Right character
+*
+*  @return
+*  Returns the number of pixels to add to the advance of the left character
+******************************************************************************/
+int32_t GLIB_fontKerning(const GLIB_Font *pFont, char left, char right)
+{
+  uint16_t key = ((uint8_t) left << 8) | (uint8_t) right;
+  uint16_t pairKey;
+  int32_t  low, high, mid;
+
+  if (pFont == NULL || pFont->pKerning == NULL) return 0;
+
+  /* Binary search in the sorted kerning pairs */
+  low  = 0;
+  high = pFont->numKerningPairs - 1;
+  while (low <= high)
+  {
+    mid     = (low + high) / 2;
+    pairKey = (pFont->pKerning[mid].left << 8) | pFont->pKerning[mid].right;
+
+    if (pairKey == key) return pFont->pKerning[mid].adjust;
+    if (pairKey < key) low = mid + 1;
+    else high = mid - 1;
+  }
+
+  return 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes the colors between the background and foreground color of a
+*  GLIB_Context, converted for the display or surface of the context
+*
+*  @param pRamp
+*  Pointer to the GLIB_BlendRamp to compute
+*  @param pContext
+*  Pointer to the GLIB_Context that holds the colors
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_blendRampInit(GLIB_BlendRamp *pRamp, const GLIB_Context *pContext)
+{
+  /* Check arguments */
+  if (pRamp == NULL || pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  uint32_t alpha;
+
+  for (alpha = 0; alpha < GLIB_BLEND_RAMP_SIZE; alpha++)
+  {
+    pRamp->colors[alpha] = GLIB_colorNative(pContext,
+                                            blendColor(pContext->foregroundColor,
+                                                       pContext->backgroundColor, alpha));
+  }
+
+  pRamp->foregroundColor = pContext->foregroundColor;
+  pRamp->backgroundColor = pContext->backgroundColor;
+  pRamp->surfaceFormat   = (pContext->pSurface != NULL);
+  pRamp->valid           = 1;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a char using a proportional font
+*
+*  @param pContext
+*  Pointer to the GLIB_Context
+*  @param pFont
+*  Pointer to the font
+*  @param myChar
+*  Char to be drawn
+*  @param x
+*  Start x-coordinate for the char (Upper left corner of the character cell)
+*  @param y
+*  Start y-coordinate for the char (Upper left corner of the character cell)
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context. If opaque == 1, the background color
+*  is used for the whole character cell.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawCharFont(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                           char myChar, uint16_t x, uint16_t y, uint32_t opaque)
+{
+  /* Check arguments */
+  if (pContext == NULL || pFont == NULL) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_Glyph *pGlyph = GLIB_fontGlyph(pFont, myChar);
+  const uint32_t   *pRamp  = NULL;
+  GLIB_BlendRamp   localRamp;
+
+  if (pGlyph == NULL) return GLIB_INVALID_CHAR;
+
+  if ((pFont->bitsPerPixel == 4) && (opaque == 1))
+  {
+    pRamp = getRamp(pContext, &localRamp);
+  }
+
+  return drawGlyph(pContext, pFont, pGlyph, x, y, opaque, pRamp);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string using a proportional font. Kerning is applied between
+*  each pair of characters.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pFont
+*  Pointer to the font
+*  @param pString
+*  Pointer to the string that is drawn
+*  @param sLength
+*  Number of characters in the string
+*  @param x0
+*  Start x-coordinate for the string (Upper left corner)
+*  @param y0
+*  Start y-coordinate for the string (Upper left corner)
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawStringFont(const GLIB_Context *pContext, const GLIB_Font *pFont,
+                             const char *pString, uint16_t sLength,
+                             uint16_t x0, uint16_t y0, uint32_t opaque)
+{
+  /* Check arguments */
+  if (pContext == NULL || pFont == NULL || pString == NULL) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_Glyph *pGlyph;
+  EMSTATUS         status;
+  uint32_t         didDraw = 0;
+  uint16_t         idx;
+  int32_t          x = x0;
+  int32_t          y = y0;
+  const uint32_t   *pRamp = NULL;
+  GLIB_BlendRamp   localRamp;
+
+  /* Anti-aliased glyphs use the same ramp for the whole string */
+  if ((pFont->bitsPerPixel == 4) && (opaque == 1))
+  {
+    pRamp = getRamp(pContext, &localRamp);
+  }
+
+  /* Loops through the string and prints char for char */
+  for (idx = 0; idx < sLength; idx++)
+  {
+    /* Special case: Newline char */
+    if (pString[idx] == '\n')
+    {
+      x = x0;
+      y = y + pFont->height + pFont->lineSpacing;
+      continue;
+    }
+
+    pGlyph = GLIB_fontGlyph(pFont, pString[idx]);
+    if (pGlyph == NULL) return GLIB_INVALID_CHAR;
+
+    /* Move closer to or further from the previous char */
+    if ((idx > 0) && (pString[idx - 1] != '\n'))
+    {
+      x += GLIB_fontKerning(pFont, pString[idx - 1], pString[idx]);
+    }
+
+    status = drawGlyph(pContext, pFont, pGlyph, x, y, opaque, pRamp);
+    if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+    if (status == GLIB_OK) didDraw = 1;
+
+    x += pGlyph->advance;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
@@ -0,0 +1,149 @@
+ /*************************************************************************//**
+ * @file glib_font_glyphs.h
+ * @brief Energy Micro Graphics Library: Glyph-major layout of the 8x8 font
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+#ifndef __GLIB_FONT_GLYPHS_H_
+#define __GLIB_FONT_GLYPHS_H_
+
+#include <stdint.h>
+
+/* The font of glib_font.h with the rows of each glyph next to each other,
+ * one byte per row with the leftmost pixel in the LSB. Rows 0-3 are in the
+ * first word of a glyph and rows 4-7 in the second. Regenerate with
+ *   glib_fontc -count 95 glib_font.h 8 fontGlyphs
+ */
+#define fontGlyphs_WIDTH            8
+#define fontGlyphs_HEIGHT           8
+#define fontGlyphs_FIRST_CHAR       32
+#define fontGlyphs_NUM_GLYPHS       95
+#define fontGlyphs_WORDS_PER_GLYPH  2
+
+static const uint32_t fontGlyphs[] = {
+  /* ' ' */ 0x00000000, 0x00000000,
+  /* '!' */ 0x18181818, 0x00181800,
+  /* '"' */ 0x00486c6c, 0x00000000,
+  /* '#' */ 0x6cfefe6c, 0x006cfefe,
+  /* '$' */ 0x7c16fc10, 0x00107ed0,
+  /* '%' */ 0x102e6ace, 0x00e6ace8,
+  /* '&' */ 0xdc2c2c38, 0x00dc6666,
+  /* ''' */ 0x00181808, 0x00000000,
+  /* '(' */ 0x18183060, 0x00603018,
+  /* ')' */ 0x3030180c, 0x000c1830,
+  /* '*' */ 0xfe386c00, 0x00006c38,
+  /* '+' */ 0x7e181800, 0x0018187e,
+  /* ',' */ 0x1c000000, 0x000c181c,
+  /* '-' */ 0x7e000000, 0x0000007e,
+  /* '.' */ 0x00000000, 0x001c1c1c,
+  /* '/' */ 0x3060c000, 0x00060c18,
+  /* '0' */ 0xc6c6c67c, 0x007cc6c6,
+  /* '1' */ 0x30303830, 0x00783030,
+  /* '2' */ 0x3060c67c, 0x00fe0c18,
+  /* '3' */ 0x70c0c67c, 0x007cc6c0,
+  /* '4' */ 0xfec6c6c6, 0x00c0c0c0,
+  /* '5' */ 0x7e0606fe, 0x007cc6c0,
+  /* '6' */ 0x7e06c67c, 0x007cc6c6,
+  /* '7' */ 0x3060c0fe, 0x00060c18,
+  /* '8' */ 0x7cc6c67c, 0x007cc6c6,
+  /* '9' */ 0xfcc6c67c, 0x007cc6c0,
+  /* ':' */ 0x00181800, 0x00001818,
+  /* ';' */ 0x00181800, 0x000c1818,
+  /* '<' */ 0x0e1c3870, 0x0070381c,
+  /* '=' */ 0x007c7c00, 0x00007c7c,
+  /* '>' */ 0xe070381c, 0x001c3870,
+  /* '?' */ 0x70c6c67c, 0x00300030,
+  /* '@' */ 0xf6f6c67c, 0x007c0676,
+  /* 'A' */ 0xfec6c67c, 0x00c6c6c6,
+  /* 'B' */ 0x7ec6c67e, 0x007ec6c6,
+  /* 'C' */ 0x0606c67c, 0x007cc606,
+  /* 'D' */ 0xc6c6c67e, 0x007ec6c6,
+  /* 'E' */ 0x1e0606fe, 0x00fe0606,
+  /* 'F' */ 0x1e0606fe, 0x00060606,
+  /* 'G' */ 0xf606c67c, 0x00fcc6c6,
+  /* 'H' */ 0xfec6c6c6, 0x00c6c6c6,
+  /* 'I' */ 0x1818183c, 0x003c1818,
+  /* 'J' */ 0x30303078, 0x001c3630,
+  /* 'K' */ 0x1e3666c6, 0x00c66636,
+  /* 'L' */ 0x06060606, 0x00fe0606,
+  /* 'M' */ 0xd6feeec6, 0x00c6c6c6,
+  /* 'N' */ 0xf6decec6, 0x00c6c6e6,
+  /* 'O' */ 0xc6c6c67c, 0x007cc6c6,
+  /* 'P' */ 0x7ec6c67e, 0x00060606,
+  /* 'Q' */ 0xc6c6c67c, 0x00dc66b6,
+  /* 'R' */ 0x7ec6c67e, 0x00c6c6c6,
+  /* 'S' */ 0x7c06c67c, 0x007cc6c0,
+  /* 'T' */ 0x1818187e, 0x00181818,
+  /* 'U' */ 0xc6c6c6c6, 0x007cc6c6,
+  /* 'V' */ 0xc6c6c6c6, 0x00386cc6,
+  /* 'W' */ 0xd6c6c6c6, 0x00c6eefe,
+  /* 'X' */ 0x386cc6c6, 0x00c6c66c,
+  /* 'Y' */ 0xfcc6c6c6, 0x007ec0c0,
+  /* 'Z' */ 0x3060c0fe, 0x00fe0c18,
+  /* '[' */ 0x0c0c0c7c, 0x007c0c0c,
+  /* '\' */ 0x180c0600, 0x00c06030,
+  /* ']' */ 0x6060607c, 0x007c6060,
+  /* '^' */ 0xc66c3810, 0x00000000,
+  /* '_' */ 0x00000000, 0x00fefe00,
+  /* '`' */ 0x00040c0c, 0x00000000,
+  /* 'a' */ 0x603c0000, 0x007c667c,
+  /* 'b' */ 0x663e0606, 0x003e6666,
+  /* 'c' */ 0x063c0000, 0x003c0606,
+  /* 'd' */ 0x667c6060, 0x007c6666,
+  /* 'e' */ 0x663c0000, 0x003c067e,
+  /* 'f' */ 0x0c3c0c38, 0x000c0c0c,
+  /* 'g' */ 0x663c0000, 0x003e607c,
+  /* 'h' */ 0x663e0606, 0x00666666,
+  /* 'i' */ 0x18001800, 0x00701818,
+  /* 'j' */ 0x30003000, 0x001c3630,
+  /* 'k' */ 0x36660606, 0x0066361e,
+  /* 'l' */ 0x0c0c0c0c, 0x00380c0c,
+  /* 'm' */ 0xd66e0000, 0x00c6c6d6,
+  /* 'n' */ 0x663e0000, 0x00666666,
+  /* 'o' */ 0x663c0000, 0x003c6666,
+  /* 'p' */ 0x663e0000, 0x0006063e,
+  /* 'q' */ 0x663c0000, 0x005c2656,
+  /* 'r' */ 0x6e360000, 0x00060606,
+  /* 's' */ 0x063c0000, 0x003e603c,
+  /* 't' */ 0x7c181800, 0x00701818,
+  /* 'u' */ 0x66660000, 0x007c6666,
+  /* 'v' */ 0x66660000, 0x00183c66,
+  /* 'w' */ 0xc6c60000, 0x00fcd6d6,
+  /* 'x' */ 0x3c660000, 0x00663c18,
+  /* 'y' */ 0x66660000, 0x003e607c,
+  /* 'z' */ 0x307e0000, 0x007e0c18,
+  /* '{' */ 0x0c181830, 0x00301818,
+  /* '|' */ 0x00181818, 0x00181818,
+  /* '}' */ 0x60303018, 0x00183030,
+  /* '~' */ 0x0062d68c, 0x00000000,
+};
+
+#endif
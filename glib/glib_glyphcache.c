@@ -0,0 +1,279 @@
+ /*************************************************************************//**
+ * @file glib_glyphcache.c
+ * @brief Energy Micro Graphics Library: Glyph Cache
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Local function prototypes */
+static uint32_t entryIndex(const GLIB_GlyphCache *pCache, const void *pFont,
+                           uint16_t glyph, uint32_t foregroundColor,
+                           uint32_t backgroundColor);
+
+/**************************************************************************//**
+*  @brief
+*  Returns the index of the only entry a glyph and color pair can be stored
+*  in, from a hash of the key
+******************************************************************************/
+static uint32_t entryIndex(const GLIB_GlyphCache *pCache, const void *pFont,
+                           uint16_t glyph, uint32_t foregroundColor,
+                           uint32_t backgroundColor)
+{
+  uint32_t hash = (uint32_t) (uintptr_t) pFont;
+
+  hash = (hash ^ glyph) * 16777619u;
+  hash = (hash ^ foregroundColor) * 16777619u;
+  hash = (hash ^ backgroundColor) * 16777619u;
+  hash ^= hash >> 16;
+
+  return hash % pCache->numEntries;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize an empty glyph cache on top of a buffer
+*
+*  @param pCache
+*  Pointer to the GLIB_GlyphCache to initialize
+*  @param buffer
+*  Buffer for the cache entries, aligned for uint32_t. Each entry takes
+*  sizeof(GLIB_GlyphCacheEntry) bytes.
+*  @param size
+*  Size of the buffer in bytes
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_glyphCacheInit(GLIB_GlyphCache *pCache, void *buffer, uint32_t size)
+{
+  /* Check arguments */
+  if (pCache == NULL || buffer == NULL) return GLIB_INVALID_ARGUMENT;
+  if (size < sizeof(GLIB_GlyphCacheEntry)) return GLIB_INVALID_ARGUMENT;
+
+  pCache->entries    = (GLIB_GlyphCacheEntry *) buffer;
+  pCache->numEntries = size / sizeof(GLIB_GlyphCacheEntry);
+
+  return GLIB_glyphCacheFlush(pCache);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Removes all glyphs from a glyph cache. Must be called if a font that is
+*  in the cache is changed or freed.
+*
+*  @param pCache
+*  Pointer to the GLIB_GlyphCache
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_glyphCacheFlush(GLIB_GlyphCache *pCache)
+{
+  /* Check arguments */
+  if (pCache == NULL) return GLIB_INVALID_ARGUMENT;
+
+  uint32_t i;
+
+  for (i = 0; i < pCache->numEntries; i++)
+  {
+    pCache->entries[i].pFont = NULL;
+  }
+
+  for (i = 0; i < GLIB_GLYPH_CACHE_RAMPS; i++)
+  {
+    pCache->ramps[i].valid = 0;
+  }
+
+  pCache->useCounter = 0;
+  pCache->hits       = 0;
+  pCache->misses     = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Finds a rendered glyph in a glyph cache
+*
+*  @param pCache
+*  Pointer to the GLIB_GlyphCache
+*  @param pFont
+*  Font the glyph belongs to
+*  @param glyph
+*  Character code of the glyph
+*  @param foregroundColor
+*  24-bit foreground color
+*  @param backgroundColor
+*  24-bit background color
+*
+*  @return
+*  Returns a pointer to the RGB565 pixels of the glyph box, or NULL if it is
+*  not cached
+******************************************************************************/
+const uint16_t *GLIB_glyphCacheLookup(GLIB_GlyphCache *pCache, const void *pFont,
+                                      uint16_t glyph, uint32_t foregroundColor,
+                                      uint32_t backgroundColor)
+{
+  GLIB_GlyphCacheEntry *pEntry;
+
+  pEntry = &pCache->entries[entryIndex(pCache, pFont, glyph, foregroundColor,
+                                       backgroundColor)];
+  if ((pEntry->pFont == pFont) && (pEntry->glyph == glyph) &&
+      (pEntry->foregroundColor == foregroundColor) &&
+      (pEntry->backgroundColor == backgroundColor))
+  {
+    pCache->hits++;
+    return pEntry->pixels;
+  }
+
+  pCache->misses++;
+  return NULL;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Allocates the entry of a glyph in a glyph cache, replacing the glyph that
+*  was stored in it
+*
+*  @param pCache
+*  Pointer to the GLIB_GlyphCache
+*  @param pFont
+*  Font the glyph belongs to
+*  @param glyph
+*  Character code of the glyph
+*  @param foregroundColor
+*  24-bit foreground color
+*  @param backgroundColor
+*  24-bit background color
+*
+*  @return
+*  Returns a pointer to GLIB_GLYPH_CACHE_MAX_PIXELS RGB565 pixels that the
+*  caller must fill with the rendered glyph box
+******************************************************************************/
+uint16_t *GLIB_glyphCacheInsert(GLIB_GlyphCache *pCache, const void *pFont,
+                                uint16_t glyph, uint32_t foregroundColor,
+                                uint32_t backgroundColor)
+{
+  GLIB_GlyphCacheEntry *pEntry;
+
+  pEntry = &pCache->entries[entryIndex(pCache, pFont, glyph, foregroundColor,
+                                       backgroundColor)];
+
+  pEntry->pFont           = pFont;
+  pEntry->glyph           = glyph;
+  pEntry->foregroundColor = foregroundColor;
+  pEntry->backgroundColor = backgroundColor;
+
+  return pEntry->pixels;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the blend ramp for the colors of a GLIB_Context. The ramp is computed
+*  if it is not in the cache, replacing the least recently used one.
+*
+*  @param pCache
+*  Pointer to the GLIB_GlyphCache
+*  @param pContext
+*  Pointer to the GLIB_Context that holds the colors
+*
+*  @return
+*  Returns a pointer to GLIB_BLEND_RAMP_SIZE colors for GLIB_writeDataNative()
+******************************************************************************/
+const uint32_t *GLIB_glyphCacheRamp(GLIB_GlyphCache *pCache, const GLIB_Context *pContext)
+{
+  GLIB_BlendRamp *pRamp;
+  GLIB_BlendRamp *pVictim       = &pCache->ramps[0];
+  uint16_t       surfaceFormat = (pContext->pSurface != NULL);
+  uint32_t       i;
+
+  pCache->useCounter++;
+
+  for (i = 0; i < GLIB_GLYPH_CACHE_RAMPS; i++)
+  {
+    pRamp = &pCache->ramps[i];
+    if (pRamp->valid && (pRamp->foregroundColor == pContext->foregroundColor) &&
+        (pRamp->backgroundColor == pContext->backgroundColor) &&
+        (pRamp->surfaceFormat == surfaceFormat))
+    {
+      pRamp->lastUse = pCache->useCounter;
+      return pRamp->colors;
+    }
+
+    if (!pVictim->valid) continue;
+    if (!pRamp->valid ||
+        (pCache->useCounter - pRamp->lastUse > pCache->useCounter - pVictim->lastUse))
+    {
+      pVictim = pRamp;
+    }
+  }
+
+  GLIB_blendRampInit(pVictim, pContext);
+  pVictim->lastUse = pCache->useCounter;
+
+  return pVictim->colors;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Make the GLIB_Context keep the glyphs it draws in a glyph cache
+*
+*  Only opaque glyphs whose glyph box is entirely inside the clipping region
+*  and has at most GLIB_GLYPH_CACHE_MAX_PIXELS pixels are drawn from the
+*  cache. Cached glyphs are stored and written as RGB565, so on a display
+*  with more color depth their colors are rounded to RGB565.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pCache
+*  Pointer to the glyph cache, or NULL to stop caching
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setGlyphCache(GLIB_Context *pContext, GLIB_GlyphCache *pCache)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pContext->pGlyphCache = pCache;
+
+  return GLIB_OK;
+}
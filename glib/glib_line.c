@@ -1,487 +1,702 @@
- /*************************************************************************//**
- * @file glib_line.c
- * @brief Energy Micro Graphics Library: Line Drawing Routines
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-/* Standard C header files */
-#include <stdint.h>
-
-/* EM types */
-#include "em_types.h"
-
-/* GLIB Header files */
-#include "glib.h"
-
-/* Local function prototypes */
-static uint8_t GLIB_getClipCode(const GLIB_Context *pContext, uint16_t x, uint16_t y);
-static uint32_t GLIB_clipLine(const GLIB_Context *pContext, uint16_t *pX1, uint16_t *pY1,
-                              uint16_t *pX2, uint16_t *pY2);
-
-/**************************************************************************//**
-*  @brief
-*  Draws a horizontal line from x1, y1 to x2, y2
-*
-*  @param pContext
-*  Pointer to a GLIB_Context in which the line is drawn. The line is drawn using the
-*  foreground color.
-*
-*  @param x1
-*  Start x-coordinate
-*  @param y1
-*  Start y-coordinate
-*  @param x2
-*  End x-coordinate
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-EMSTATUS GLIB_drawLineH(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                        uint16_t x2)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Check if line is outside of clipping region */
-  if ((y1 < pContext->clippingRegion.yMin) || (y1 > pContext->clippingRegion.yMax))
-  {
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  EMSTATUS status;
-
-  /* Reset clipping area in DMD driver */
-  status = GLIB_resetDisplayClippingArea(pContext);
-  if (status != 0) return status;
-
-  /* Swap the coordinates if x1 is larger than x2 */
-  if (x1 > x2)
-  {
-    int16_t swap;
-    swap = x1;
-    x1   = x2;
-    x2   = swap;
-  }
-
-  /* Check if entire line is outside clipping region */
-  if ((x1 > pContext->clippingRegion.xMax) || (x2 < pContext->clippingRegion.xMin))
-  {
-    /* Nothing to draw */
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  /* Clip the line if necessary */
-  if (x1 < pContext->clippingRegion.xMin)
-  {
-    x1 = pContext->clippingRegion.xMin;
-  }
-
-  if (x2 > pContext->clippingRegion.xMax)
-  {
-    x2 = pContext->clippingRegion.xMax;
-  }
-
-  /* Draw line using display driver */
-  uint8_t  red;
-  uint8_t  green;
-  uint8_t  blue;
-  uint32_t length = x2 - x1 + 1;
-  GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
-
-  return DMD_writeColor(x1, y1, red, green, blue, length);
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a vertical line from x1, y1 to x1, y2
-*
-*  @param pContext
-*  Pointer to a GLIB_Context which the line is drawn. The line is drawn using the
-*  foreground color.
-*  @param x1
-*  Start x-coordinate
-*  @param y1
-*  Start y-coordinate
-*  @param y2
-*  End y-coordinate
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawLineV(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                        uint16_t y2)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Check if line is outside of clipping region */
-  if ((x1 < pContext->clippingRegion.xMin) || (x1 > pContext->clippingRegion.xMax))
-  {
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  EMSTATUS status;
-
-  /* Swap the coordinates if y1 is larger than y2 */
-  if (y1 > y2)
-  {
-    uint16_t swap;
-    swap = y1;
-    y1   = y2;
-    y2   = swap;
-  }
-
-  /* Check if entire line is outside clipping region */
-  if ((y1 > pContext->clippingRegion.yMax) || (y2 < pContext->clippingRegion.yMin))
-  {
-    /* Nothing to draw */
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  /* Clip the line if necessary */
-  if (y1 < pContext->clippingRegion.yMin)
-  {
-    y1 = pContext->clippingRegion.yMin;
-  }
-
-  if (y2 > pContext->clippingRegion.yMax)
-  {
-    y2 = pContext->clippingRegion.yMax;
-  }
-
-#if 0
-  /* Draw line using a for loop */
-  uint16_t y;
-  for (y = y1; y < y2; y++)
-  {
-    status = GLIB_drawPixel(pContext, x1, y);
-    if (status != 0) return status;
-  }
-
-#else
-  uint16_t length = y2 - y1 + 1;
-  status = DMD_setClippingArea(x1, y1, 1, length);
-  if (status != DMD_OK) return status;
-
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-
-  GLIB_colorTranslate24bpp(pContext->foregroundColor, &red, &green, &blue);
-
-  status = DMD_writeColor(0, 0, red, green, blue, length);
-  if (status != DMD_OK) return status;
-
-  status = GLIB_resetDisplayClippingArea(pContext);
-  if (status != GLIB_OK) return status;
-#endif
-
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Gets the clip code for the point that is used by Cohen-Sutherland algorithm
-*
-*  @param pContext
-*  Pointer to the GLIB_Context which holds the clipping region
-*  @param x
-*  Start x-coordinate
-*  @param y
-*  Start y-coordinate
-*
-*  @return
-*  Returns the 4-bit clip code in a uint8_t
-*
-******************************************************************************/
-
-static uint8_t GLIB_getClipCode(const GLIB_Context *pContext, uint16_t x, uint16_t y)
-{
-  uint8_t code;
-
-  /* Set the clipping code to zero */
-  code = 0;
-
-  /* Check if the point is to the left of the clipping region */
-  if (x < pContext->clippingRegion.xMin)
-  {
-    code |= 1;
-  }
-  /* Check if the point is to the right of the clipping region */
-  if (x > pContext->clippingRegion.xMax)
-  {
-    code |= 2;
-  }
-  /* Check if the point is below the clipping region */
-  if (y > pContext->clippingRegion.yMax)
-  {
-    code |= 4;
-  }
-  /* Check if point is above clipping region */
-  if (y < pContext->clippingRegion.yMin)
-  {
-    code |= 8;
-  }
-
-  return code;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Clips the line if necessary, using the Cohen-Sutherland algorithm for clipping
-*  lines. See Wikipedia for algorithm.
-*
-*  The points are moved using the linear equations:
-*  y=y0+slope*(x-x0),x=x0+(1/slope)*(y-y0)
-*
-*  @param pContext
-*  Pointer to the GLIB_Context which holds the clipping region
-*  @param pX1
-*  Pointer to the start x-coordinate
-*  @param pY1
-*  Pointer to the start y-coordinate
-*  @param pX2
-*  Pointer to the end-x coordinate
-*  @param pY2
-*  Pointer to the end-y coordinate
-*
-*  @return
-*  Returns 1 if the line is inside the clipping region, otherwise return 0
-******************************************************************************/
-static uint32_t GLIB_clipLine(const GLIB_Context *pContext, uint16_t *pX1,
-                              uint16_t *pY1, uint16_t *pX2, uint16_t *pY2)
-{
-  uint8_t  currentCode, code1, code2;
-  uint16_t x=0, y=0;
-
-  /* Compute the clipping code for the two points */
-  code1 = GLIB_getClipCode(pContext, *pX1, *pY1);
-  code2 = GLIB_getClipCode(pContext, *pX2, *pY2);
-
-  while (1)
-  {
-    /* Case 1: Check if the points is inside the clipping rectangle */
-    if ((code1 | code2) == 0) return 1;
-
-    /* Case 2: Check if the points can be trivially rejected */
-    if (code1 & code2) return 0;
-
-    /* Case 3: Move the points so they can be either trivially accepted or rejected */
-    /* Choose one of the points that are outside of the clipping region */
-    if (code1) currentCode = code1;
-    else currentCode = code2;
-
-    /* Check if currentCode is to the left of the clipping region */
-    if (currentCode & 1)
-    {
-      /* Move the point to the left edge of the clipping region */
-      y = *pY1 + ((*pY2 - *pY1) * (pContext->clippingRegion.xMin - *pX1)) / (*pX2 - *pX1);
-      x = pContext->clippingRegion.xMin;
-    }
-
-    /* Check if currentCode is to the right of the clipping region */
-    else if (currentCode & 2)
-    {
-      /* Move the point to the right edge of the clipping region */
-      x = pContext->clippingRegion.xMax;
-      y = *pY1 + ((*pY2 - *pY1) * (pContext->clippingRegion.xMax - *pX1)) / (*pX2 - *pX1);
-    }
-
-    /* Check if currentCode is below the clipping region */
-    else if (currentCode & 4)
-    {
-      /* Move the point to the bottom of the clipping region */
-      y = pContext->clippingRegion.yMax;
-      x = *pX1 + ((*pX2 - *pX1) * (pContext->clippingRegion.yMax - *pY1)) / (*pY2 - *pY1);
-    }
-
-    /* Check if currentCode is above the clipping region */
-    else if (currentCode & 8)
-    {
-      /* Move the point to the top of the clipping region */
-      y = pContext->clippingRegion.yMin;
-      x = *pX1 + ((*pX2 - *pX1) * (pContext->clippingRegion.yMin - *pY1)) / (*pY2 - *pY1);
-    }
-
-    /* Determine which point is moved and set the new coordinates */
-    if (code1)
-    {
-      *pX1 = x;
-      *pY1 = y;
-      /* Compute new clipCode */
-      code1 = GLIB_getClipCode(pContext, x, y);
-    }
-    else
-    {
-      *pX2 = x;
-      *pY2 = y;
-      /* Compute new clipCode */
-      code2 = GLIB_getClipCode(pContext, x, y);
-    }
-  }
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a line from x1,y1 to x2, y2
-*
-*  Draws a straight line using the Bresnham's Midpoint Line Algorithm.
-*  Checks for vertical and horizontal line.
-*
-*  @param x1
-*  Start x-coordinate
-*  @param y1
-*  Start y-coordinate
-*  @param x2
-*  End x-coordinate
-*  @param y2
-*  End y-coordinate
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawLine(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
-                       uint16_t x2, uint16_t y2)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status;
-
-  /* Check if the line is vertical */
-  if (x1 == x2)
-  {
-    /* Use algorithm for vertical line */
-    return GLIB_drawLineV(pContext, x1, y1, y2);
-  }
-
-  /* Check if the line is horizontal */
-  if (y1 == y2)
-  {
-    /* Use algorithm for horizontal line */
-    return GLIB_drawLineH(pContext, x1, y1, x2);
-  }
-
-  /* Variables that help drawing the line using only integer arithmetic */
-  int16_t error;
-  int16_t deltaX;
-  int16_t deltaY;
-
-  /* Y-direction for line */
-  int16_t yStep = 1;
-
-  /* Holds whether the line is steep */
-  uint32_t steep = 0;
-
-  /* Reset clipping area in DMD driver */
-  status = GLIB_resetDisplayClippingArea(pContext);
-  if (status != 0) return status;
-
-  /* Clip the line against the clipping region */
-  if (GLIB_clipLine(pContext, &x1, &y1, &x2, &y2) == 0)
-  {
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  /* Determine if steep or not steep
-   * (Steep means more motion in Y-direction than X-direction) */
-  uint16_t yMotion = (y2 > y1) ? (y2 - y1) : (y1 - y2);
-  uint16_t xMotion = (x2 > x1) ? (x2 - x1) : (x1 - x2);
-  if (yMotion > xMotion)
-  {
-    /* If line is steep, swap x and y values */
-    steep = 1;
-
-    error = x1;
-    x1    = y1;
-    y1    = error;
-
-    error = x2;
-    x2    = y2;
-    y2    = error;
-  }
-
-  /* Place the leftmost point in x1, y1 */
-  if (x2 < x1)
-  {
-    /* Swap x-values */
-    error = x1;
-    x1    = x2;
-    x2    = error;
-
-    /* Swap y-values */
-    error = y1;
-    y1    = y2;
-    y2    = error;
-  }
-
-  /* Compute the differences between the points */
-  deltaX = x2 - x1;
-  deltaY = (y2 > y1) ? (y2 - y1) : (y1 - y2);
-
-  /* Set error to negative half deltaX ? */
-  error = -deltaX / 2;
-
-  /* Determine which direction to step in */
-  if (y2 < y1) yStep = -1;
-
-  /* Loop through all points along the x-axis */
-  for (; x1 <= x2; x1++)
-  {
-    if (steep == 1)
-    {
-      /* If steep, swap x and y coordinates */
-      status = GLIB_drawPixel(pContext, y1, x1);
-    }
-    else
-    {
-      status = GLIB_drawPixel(pContext, x1, y1);
-    }
-
-    if (status != 0) return status;
-
-    error += deltaY;
-
-    if (error > 0)
-    {
-      y1    += yStep;
-      error -= deltaX;
-    }
-  }
-
-  return GLIB_OK;
-}
+ /*************************************************************************//**
+ * @file glib_line.c
+ * @brief Energy Micro Graphics Library: Line Drawing Routines
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB Header files */
+#include "glib.h"
+
+/* Fields of two RGB565 pixels packed in a 32-bit word, split in two groups
+ * so that each field has room to be multiplied by an alpha of up to 16.
+ * Group A holds red and blue of the low pixel and green of the high pixel.
+ * Group B is taken from the word shifted right by 5, and holds the rest. */
+#define GLIB_PIXEL_PAIR_GROUP_A    0x07E0F81F
+#define GLIB_PIXEL_PAIR_GROUP_B    0x07C0F83F
+
+/* Local function prototypes */
+static uint32_t blendPixelPair(uint32_t pair0, uint32_t pair1, uint32_t alpha);
+
+static uint32_t insideClipRects(const GLIB_Rectangle *pRects, uint32_t numRects,
+                                int32_t x, int32_t y);
+
+static uint32_t clipLine(const GLIB_Context *pContext, uint32_t steep,
+                         int32_t x1, int32_t y1, int32_t deltaX, int32_t deltaY,
+                         int32_t yStep, int32_t *pFirst, int32_t *pLast);
+
+/**************************************************************************//**
+*  @brief
+*  Draws a horizontal line from x1, y1 to x2, y2
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the line is drawn. The line is drawn using the
+*  foreground color.
+*
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param x2
+*  End x-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawLineH(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                        uint16_t x2)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  /* Check if line is outside of clipping region */
+  if ((y1 < pContext->clippingRegion.yMin) || (y1 > pContext->clippingRegion.yMax))
+  {
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Swap the coordinates if x1 is larger than x2 */
+  if (x1 > x2)
+  {
+    int16_t swap;
+    swap = x1;
+    x1   = x2;
+    x2   = swap;
+  }
+
+  /* Check if entire line is outside clipping region */
+  if ((x1 > pContext->clippingRegion.xMax) || (x2 < pContext->clippingRegion.xMin))
+  {
+    /* Nothing to draw */
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Clip the line if necessary */
+  if (x1 < pContext->clippingRegion.xMin)
+  {
+    x1 = pContext->clippingRegion.xMin;
+  }
+
+  if (x2 > pContext->clippingRegion.xMax)
+  {
+    x2 = pContext->clippingRegion.xMax;
+  }
+
+  /* Draw line */
+  return GLIB_writeColor(pContext, x1, y1, x2 - x1 + 1, 1,
+                         pContext->foregroundColor);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a vertical line from x1, y1 to x1, y2
+*
+*  @param pContext
+*  Pointer to a GLIB_Context which the line is drawn. The line is drawn using the
+*  foreground color.
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param y2
+*  End y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawLineV(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                        uint16_t y2)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  /* Check if line is outside of clipping region */
+  if ((x1 < pContext->clippingRegion.xMin) || (x1 > pContext->clippingRegion.xMax))
+  {
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  EMSTATUS status;
+
+  /* Swap the coordinates if y1 is larger than y2 */
+  if (y1 > y2)
+  {
+    uint16_t swap;
+    swap = y1;
+    y1   = y2;
+    y2   = swap;
+  }
+
+  /* Check if entire line is outside clipping region */
+  if ((y1 > pContext->clippingRegion.yMax) || (y2 < pContext->clippingRegion.yMin))
+  {
+    /* Nothing to draw */
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Clip the line if necessary */
+  if (y1 < pContext->clippingRegion.yMin)
+  {
+    y1 = pContext->clippingRegion.yMin;
+  }
+
+  if (y2 > pContext->clippingRegion.yMax)
+  {
+    y2 = pContext->clippingRegion.yMax;
+  }
+
+#if 0
+  /* Draw line using a for loop */
+  uint16_t y;
+  for (y = y1; y < y2; y++)
+  {
+    status = GLIB_drawPixel(pContext, x1, y);
+    if (status != 0) return status;
+  }
+
+#else
+  status = GLIB_writeColor(pContext, x1, y1, 1, y2 - y1 + 1,
+                           pContext->foregroundColor);
+  if (status != GLIB_OK) return status;
+#endif
+
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Clips a line in one pass, without moving it off its raster path
+*
+*  The line has been made left to right and not steep, so that its pixels
+*  are at x1 + k along the major axis and y1 + yStep * n(k) along the minor
+*  axis, for k = 0 to deltaX. n(k) = ceil((k * deltaY - deltaX / 2) / deltaX)
+*  is the number of minor steps that Bresenham's algorithm has taken. The
+*  range of k inside the clipping region is solved for directly on both axes.
+*  All products are of two 16-bit values, so they fit in 32-bit unsigned
+*  arithmetic for any coordinates.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context which holds the clipping region
+*  @param steep
+*  1 if the major axis is y
+*  @param x1
+*  Start coordinate along the major axis
+*  @param y1
+*  Start coordinate along the minor axis
+*  @param deltaX
+*  Length of the line along the major axis
+*  @param deltaY
+*  Length of the line along the minor axis, greater than 0
+*  @param yStep
+*  Direction of the line along the minor axis, 1 or -1
+*  @param pFirst
+*  Set to the first k that is inside the clipping region
+*  @param pLast
+*  Set to the last k that is inside the clipping region
+*
+*  @return
+*  Returns 1 if any pixel of the line is inside the clipping region,
+*  otherwise 0
+******************************************************************************/
+static uint32_t clipLine(const GLIB_Context *pContext, uint32_t steep,
+                         int32_t x1, int32_t y1, int32_t deltaX, int32_t deltaY,
+                         int32_t yStep, int32_t *pFirst, int32_t *pLast)
+{
+  const GLIB_Rectangle *pClip = &pContext->clippingRegion;
+  int32_t  majorMin = steep ? pClip->yMin : pClip->xMin;
+  int32_t  majorMax = steep ? pClip->yMax : pClip->xMax;
+  int32_t  minorMin = steep ? pClip->xMin : pClip->yMin;
+  int32_t  minorMax = steep ? pClip->xMax : pClip->yMax;
+  uint32_t half     = deltaX / 2;
+  int32_t  first, last, k;
+  int32_t  stepsMin, stepsMax;
+
+  /* Range of k inside the clipping region along the major axis */
+  first = (majorMin > x1) ? majorMin - x1 : 0;
+  last  = (majorMax - x1 < deltaX) ? majorMax - x1 : deltaX;
+  if (first > last) return 0;
+
+  /* Range of minor steps inside the clipping region along the minor axis */
+  stepsMin = (yStep > 0) ? minorMin - y1 : y1 - minorMax;
+  stepsMax = (yStep > 0) ? minorMax - y1 : y1 - minorMin;
+  if ((stepsMax < 0) || (stepsMin > deltaY)) return 0;
+
+  /* First k where n(k) >= stepsMin */
+  if (stepsMin > 0)
+  {
+    k = ((uint32_t) (stepsMin - 1) * deltaX + half) / deltaY + 1;
+    if (k > first) first = k;
+  }
+
+  /* Last k where n(k) <= stepsMax */
+  if (stepsMax < deltaY)
+  {
+    k = ((uint32_t) stepsMax * deltaX + half) / deltaY;
+    if (k < last) last = k;
+  }
+
+  if (first > last) return 0;
+
+  *pFirst = first;
+  *pLast  = last;
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a line from x1,y1 to x2, y2
+*
+*  Draws a straight line using the run-slice variant of Bresenham's Midpoint
+*  Line Algorithm, so that each horizontal or vertical run of pixels is
+*  written as one line. Checks for vertical and horizontal line.
+*
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param x2
+*  End x-coordinate
+*  @param y2
+*  End y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawLine(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                       uint16_t x2, uint16_t y2)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+
+  /* Check if the line is vertical */
+  if (x1 == x2)
+  {
+    /* Use algorithm for vertical line */
+    return GLIB_drawLineV(pContext, x1, y1, y2);
+  }
+
+  /* Check if the line is horizontal */
+  if (y1 == y2)
+  {
+    /* Use algorithm for horizontal line */
+    return GLIB_drawLineH(pContext, x1, y1, x2);
+  }
+
+  /* Variables that help drawing the line using only integer arithmetic */
+  int32_t error;
+  int32_t deltaX;
+  int32_t deltaY;
+  int32_t swap;
+
+  /* Y-direction for line */
+  int32_t yStep = 1;
+
+  /* Holds whether the line is steep */
+  uint32_t steep = 0;
+
+  /* Length of the current run of pixels along the major axis */
+  int32_t  run;
+
+  /* Pixels of the line inside the clipping region, counted from x1 */
+  int32_t  first, last;
+  uint32_t minorSteps;
+
+  /* Determine if steep or not steep
+   * (Steep means more motion in Y-direction than X-direction) */
+  uint16_t yMotion = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+  uint16_t xMotion = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+  if (yMotion > xMotion)
+  {
+    /* If line is steep, swap x and y values */
+    steep = 1;
+
+    swap = x1;
+    x1   = y1;
+    y1   = swap;
+
+    swap = x2;
+    x2   = y2;
+    y2   = swap;
+  }
+
+  /* Place the leftmost point in x1, y1 */
+  if (x2 < x1)
+  {
+    /* Swap x-values */
+    swap = x1;
+    x1   = x2;
+    x2   = swap;
+
+    /* Swap y-values */
+    swap = y1;
+    y1   = y2;
+    y2   = swap;
+  }
+
+  /* Compute the differences between the points */
+  deltaX = x2 - x1;
+  deltaY = (y2 > y1) ? (y2 - y1) : (y1 - y2);
+
+  /* Set error to negative half deltaX */
+  error = -deltaX / 2;
+
+  /* Determine which direction to step in */
+  if (y2 < y1) yStep = -1;
+
+  /* Check if the line is entirely outside the clipping region */
+  if (clipLine(pContext, steep, x1, y1, deltaX, deltaY, yStep, &first, &last) == 0)
+  {
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Move to the first pixel inside the clipping region, where the algorithm
+   * would be after taking n(first) minor steps. The pixels are the same as
+   * when drawing from the original start point. */
+  if ((uint32_t) first * deltaY > (uint32_t) -error)
+  {
+    minorSteps = ((uint32_t) first * deltaY + error + deltaX - 1) / deltaX;
+  }
+  else
+  {
+    minorSteps = 0;
+  }
+  error = (int32_t) ((uint32_t) first * deltaY - minorSteps * deltaX + error);
+  x2    = x1 + last;
+  x1   += first;
+  y1   += yStep * (int32_t) minorSteps;
+
+  /* Run-slice Bresenham: instead of stepping one pixel at a time, compute
+   * how many pixels along the major axis share the same minor coordinate
+   * and draw them as one horizontal or vertical line. The error term is
+   * never positive at the start of a run. */
+  while (x1 <= x2)
+  {
+    run = -error / deltaY + 1;
+    if (run > x2 - x1 + 1) run = x2 - x1 + 1;
+
+    if (steep == 1)
+    {
+      /* If steep, swap x and y coordinates */
+      status = GLIB_drawLineV(pContext, y1, x1, x1 + run - 1);
+    }
+    else
+    {
+      status = GLIB_drawLineH(pContext, x1, y1, x1 + run - 1);
+    }
+
+    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+
+    x1    += run;
+    error += run * deltaY;
+
+    if (error > 0)
+    {
+      y1    += yStep;
+      error -= deltaX;
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Blends two pairs of RGB565 pixels packed in 32-bit words, two pixels and
+*  all three color fields at a time
+*
+*  @param pair0
+*  Pixels to blend from
+*  @param pair1
+*  Pixels to blend towards
+*  @param alpha
+*  Weight of pair1, from 0 to 16
+*
+*  @return
+*  Returns the blended pixels, packed like the input
+******************************************************************************/
+static uint32_t blendPixelPair(uint32_t pair0, uint32_t pair1, uint32_t alpha)
+{
+  uint32_t groupA, groupB;
+
+  groupA = ((pair0 & GLIB_PIXEL_PAIR_GROUP_A) * (16 - alpha) +
+            (pair1 & GLIB_PIXEL_PAIR_GROUP_A) * alpha) >> 4;
+  groupB = (((pair0 >> 5) & GLIB_PIXEL_PAIR_GROUP_B) * (16 - alpha) +
+            ((pair1 >> 5) & GLIB_PIXEL_PAIR_GROUP_B) * alpha) >> 4;
+
+  return (groupA & GLIB_PIXEL_PAIR_GROUP_A) | ((groupB & GLIB_PIXEL_PAIR_GROUP_B) << 5);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws an anti-aliased line from x1,y1 to x2, y2
+*
+*  Draws a line using Wu's algorithm. At each step along the major axis, the
+*  two pixels on either side of the line share the color, weighted by how
+*  close the line passes to each of them.
+*
+*  The line is meant to be drawn into the surface of the GLIB_Context, as
+*  set by GLIB_setSurface() or GLIB_renderBands(). Each pair of pixels is
+*  then read from RAM and blended in one step, and the display is never read.
+*  Without a surface, the pixels are blended with the background color of
+*  the context instead of what is on the display.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the line is drawn. The line is drawn
+*  using the foreground color.
+*  @param x1
+*  Start x-coordinate
+*  @param y1
+*  Start y-coordinate
+*  @param x2
+*  End x-coordinate
+*  @param y2
+*  End y-coordinate
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawLineAA(const GLIB_Context *pContext, uint16_t x1, uint16_t y1,
+                         uint16_t x2, uint16_t y2)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  /* Horizontal and vertical lines have no pixels to blend */
+  if ((x1 == x2) || (y1 == y2))
+  {
+    return GLIB_drawLine(pContext, x1, y1, x2, y2);
+  }
+
+  const GLIB_Surface   *pSurface = pContext->pSurface;
+  GLIB_Rectangle       clip      = pContext->clippingRegion;
+  GLIB_BlendRamp       localRamp;
+  const uint32_t       *pRamp    = NULL;
+  uint32_t             color     = 0;
+  uint32_t             background, backgroundNext;
+  EMSTATUS             status;
+  uint32_t             steep     = 0;
+  uint32_t             didDraw   = 0;
+  int32_t              swap, deltaX, deltaY;
+  int32_t              majorMin, majorMax, minorMin, minorMax;
+  int32_t              first, last, major, minor;
+  int32_t              x, y, offset, next;
+  uint32_t             position, slope, alpha;
+  uint32_t             inside, insideNext;
+  uint32_t             pair;
+  const GLIB_Rectangle *pRects;
+  uint32_t             numRects  = 0;
+
+  /* Pixels are only drawn where the surface and the clipping region overlap */
+  if (pSurface != NULL)
+  {
+    if (clip.xMin < pSurface->area.xMin) clip.xMin = pSurface->area.xMin;
+    if (clip.yMin < pSurface->area.yMin) clip.yMin = pSurface->area.yMin;
+    if (clip.xMax > pSurface->area.xMax) clip.xMax = pSurface->area.xMax;
+    if (clip.yMax > pSurface->area.yMax) clip.yMax = pSurface->area.yMax;
+    if ((clip.xMin > clip.xMax) || (clip.yMin > clip.yMax)) return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Make x the major axis, and place the leftmost point in x1, y1 */
+  if (((y2 > y1) ? (y2 - y1) : (y1 - y2)) > ((x2 > x1) ? (x2 - x1) : (x1 - x2)))
+  {
+    steep = 1;
+
+    swap = x1;
+    x1   = y1;
+    y1   = swap;
+
+    swap = x2;
+    x2   = y2;
+    y2   = swap;
+  }
+
+  if (x2 < x1)
+  {
+    swap = x1;
+    x1   = x2;
+    x2   = swap;
+
+    swap = y1;
+    y1   = y2;
+    y2   = swap;
+  }
+
+  majorMin = steep ? clip.yMin : clip.xMin;
+  majorMax = steep ? clip.yMax : clip.xMax;
+  minorMin = steep ? clip.xMin : clip.yMin;
+  minorMax = steep ? clip.xMax : clip.yMax;
+
+  /* Steps along the major axis inside the clipping region */
+  deltaX = x2 - x1;
+  deltaY = y2 - y1;
+  first  = (majorMin > x1) ? majorMin - x1 : 0;
+  last   = (majorMax - x1 < deltaX) ? majorMax - x1 : deltaX;
+  if (first > last) return GLIB_DID_NOT_DRAW;
+
+  /* Position along the minor axis in 16.16 fixed point. The slope is at
+   * most 1, so it and the position fit in 32 bits. */
+  slope    = ((uint32_t) ((deltaY < 0) ? -deltaY : deltaY) << 16) / deltaX;
+  position = (uint32_t) y1 << 16;
+  if (deltaY < 0)
+  {
+    position -= first * slope;
+    slope     = -slope;
+  }
+  else
+  {
+    position += first * slope;
+  }
+
+  if (pSurface != NULL)
+  {
+    color = GLIB_colorTranslateRGB565(pContext->foregroundColor);
+  }
+  else if (pContext->pGlyphCache != NULL)
+  {
+    pRamp = GLIB_glyphCacheRamp(pContext->pGlyphCache, pContext);
+  }
+  else
+  {
+    GLIB_blendRampInit(&localRamp, pContext);
+    pRamp = localRamp.colors;
+  }
+
+  /* Distance in the pixel buffer to the next pixel along the minor axis */
+  next = (steep || pSurface == NULL) ? 1 : pSurface->stride;
+
+  /* The pixels are written directly to the surface, so a pushed clip
+   * region is tested here */
+  pRects = GLIB_getClipRects(pContext, &numRects);
+
+  for (major = x1 + first; major <= x1 + last; major++, position += slope)
+  {
+    minor = position >> 16;
+    alpha = (position >> 12) & 0xF;
+
+    /* The pixel after the line along the minor axis gets the weight alpha */
+    inside     = (minor >= minorMin) && (minor <= minorMax);
+    insideNext = (alpha != 0) && (minor + 1 >= minorMin) && (minor + 1 <= minorMax);
+    if (!inside && !insideNext) continue;
+
+    x = steep ? minor : major;
+    y = steep ? major : minor;
+
+    if (pSurface != NULL)
+    {
+      if (pRects != NULL)
+      {
+        inside     = inside && insideClipRects(pRects, numRects, x, y);
+        insideNext = insideNext &&
+                     insideClipRects(pRects, numRects, x + (steep ? 1 : 0), y + (steep ? 0 : 1));
+        if (!inside && !insideNext) continue;
+      }
+
+      offset = (y - pSurface->area.yMin) * pSurface->stride + (x - pSurface->area.xMin);
+
+      /* Blend the pixel towards the line color and the next pixel away from it */
+      background     = inside ? pSurface->pixels[offset] : 0;
+      backgroundNext = insideNext ? pSurface->pixels[offset + next] : 0;
+      pair = blendPixelPair(color | (backgroundNext << 16), background | (color << 16),
+                            alpha);
+
+      if (inside) pSurface->pixels[offset] = pair;
+      if (insideNext) pSurface->pixels[offset + next] = pair >> 16;
+    }
+    else
+    {
+      /* The ramp has one level less, which leaves the pair summing to the
+       * foreground color */
+      if (inside && alpha != GLIB_BLEND_RAMP_SIZE - 1)
+      {
+        status = GLIB_writeDataNative(pContext, x, y, 1, 1,
+                                      &pRamp[GLIB_BLEND_RAMP_SIZE - 1 - alpha]);
+        if (status != GLIB_OK) return status;
+      }
+      if (insideNext)
+      {
+        status = GLIB_writeDataNative(pContext, x + (steep ? 1 : 0), y + (steep ? 0 : 1),
+                                      1, 1, &pRamp[alpha]);
+        if (status != GLIB_OK) return status;
+      }
+    }
+
+    didDraw = 1;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+
+  if (pSurface != NULL && pContext->pDirty != NULL)
+  {
+    /* The pixels next to the line stay inside the box of its end points */
+    minorMin = (minorMin > ((y1 < y2) ? y1 : y2)) ? minorMin : ((y1 < y2) ? y1 : y2);
+    minorMax = (minorMax < ((y1 < y2) ? y2 : y1)) ? minorMax : ((y1 < y2) ? y2 : y1);
+
+    GLIB_Rectangle box;
+    box.xMin = steep ? minorMin : x1 + first;
+    box.xMax = steep ? minorMax : x1 + last;
+    box.yMin = steep ? x1 + first : minorMin;
+    box.yMax = steep ? x1 + last : minorMax;
+    GLIB_dirtyAdd(pContext->pDirty, &box);
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if a pixel is inside one of the rectangles of a clip region
+******************************************************************************/
+static uint32_t insideClipRects(const GLIB_Rectangle *pRects, uint32_t numRects,
+                                int32_t x, int32_t y)
+{
+  uint32_t i;
+
+  for (i = 0; i < numRects; i++)
+  {
+    if (GLIB_rectContainsPoint(&pRects[i], x, y)) return 1;
+  }
+
+  return 0;
+}
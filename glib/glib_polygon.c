@@ -1,113 +1,463 @@
- /*************************************************************************//**
- * @file glib_polygon.c
- * @brief Energy Micro Graphics Library: Polygon Drawing Routines
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-/* C-header files */
-#include <stdint.h>
-
-/* EM types */
-#include "em_types.h"
-
-/* GLIB header files */
-#include "glib.h"
-
-/**************************************************************************//**
-*  @brief
-*  Draws a polygon using Bresnham's Midpoint Line Algorithm.
-*
-*  This function draws a line between all points outlining the polygon.
-*  The first and last point doesn't have to be the same. The function automatically
-*  draws a line from the start point to the end point.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context which the line is drawn. The lines are drawn using the
-*  foreground color.
-*  @param numPoints
-*  Number of points in the polygon ( Has to be greater than 1 )
-*  @param polyPoints
-*  Pointer to array of polygon points. The points are laid out like this: polyPoints = {x1,y1,x2,y2 ... }
-*  Polypoints has to contain at least (numPoints * 2) entries
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawPolygon(const GLIB_Context *pContext,
-                          uint32_t numPoints, uint16_t *polyPoints)
-{
-  /* Check arguments */
-  if (pContext == NULL || polyPoints == NULL || numPoints < 2)
-    return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS status;
-  uint32_t didDraw = 0;
-
-  uint32_t counter;
-  uint16_t firstX;
-  uint16_t firstY;
-  uint16_t startX;
-  uint16_t startY;
-  uint16_t endX;
-  uint16_t endY;
-
-  startX = *polyPoints++;
-  startY = *polyPoints++;
-  firstX = startX;
-  firstY = startY;
-
-  /* Loop through the points by moving the pointer */
-  for (counter = 1; counter < numPoints; counter++)
-  {
-    endX = *polyPoints++;
-    endY = *polyPoints++;
-
-    /* Draw a line between each pair of points */
-    status = GLIB_drawLine(pContext, startX, startY, endX, endY);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (status == 0) didDraw = 1;
-
-    startX = endX;
-    startY = endY;
-  }
-
-  /* Draw a line from last point to first point */
-  if ((endX != firstX) || (endY != firstY))
-  {
-    status = GLIB_drawLine(pContext, firstX, firstY, endX, endY);
-    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
-    if (status == 0) didDraw = 1;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
+ /*************************************************************************//**
+ * @file glib_polygon.c
+ * @brief Energy Micro Graphics Library: Polygon Drawing Routines
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* C-header files */
+#include <stdint.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Edge of a filled polygon, from its top row down to the row before yEnd */
+typedef struct
+{
+  /* x where the edge crosses the current row, in 16.16 fixed point */
+  int32_t x;
+
+  /* Change of x from one row to the next, in 16.16 fixed point */
+  int32_t dxdy;
+
+  int32_t yStart;
+  int32_t yEnd;
+
+  /* 1 if the edge goes down from the first point to the second, else -1 */
+  int32_t winding;
+} GLIB_PolygonEdge;
+
+/* Local function prototypes */
+static int32_t fixedDiv(int32_t dividend, int32_t divisor);
+static void sortEdges(GLIB_PolygonEdge *pEdges, uint32_t numEdges);
+
+/**************************************************************************//**
+*  @brief
+*  Draws a polygon using Bresnham's Midpoint Line Algorithm.
+*
+*  This function draws a line between all points outlining the polygon.
+*  The first and last point doesn't have to be the same. The function automatically
+*  draws a line from the start point to the end point.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context which the line is drawn. The lines are drawn using the
+*  foreground color.
+*  @param numPoints
+*  Number of points in the polygon ( Has to be greater than 1 )
+*  @param polyPoints
+*  Pointer to array of polygon points. The points are laid out like this: polyPoints = {x1,y1,x2,y2 ... }
+*  Polypoints has to contain at least (numPoints * 2) entries
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawPolygon(const GLIB_Context *pContext,
+                          uint32_t numPoints, uint16_t *polyPoints)
+{
+  /* Check arguments */
+  if (pContext == NULL || polyPoints == NULL || numPoints < 2)
+    return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+  uint32_t didDraw = 0;
+
+  uint32_t counter;
+  uint16_t firstX;
+  uint16_t firstY;
+  uint16_t startX;
+  uint16_t startY;
+  uint16_t endX;
+  uint16_t endY;
+
+  startX = *polyPoints++;
+  startY = *polyPoints++;
+  firstX = startX;
+  firstY = startY;
+
+  /* Loop through the points by moving the pointer */
+  for (counter = 1; counter < numPoints; counter++)
+  {
+    endX = *polyPoints++;
+    endY = *polyPoints++;
+
+    /* Draw a line between each pair of points */
+    status = GLIB_drawLine(pContext, startX, startY, endX, endY);
+    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+    if (status == 0) didDraw = 1;
+
+    startX = endX;
+    startY = endY;
+  }
+
+  /* Draw a line from last point to first point */
+  if ((endX != firstX) || (endY != firstY))
+  {
+    status = GLIB_drawLine(pContext, firstX, firstY, endX, endY);
+    if (status != 0 && status != GLIB_DID_NOT_DRAW) return status;
+    if (status == 0) didDraw = 1;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a filled polygon using an active edge table.
+*
+*  The polygon is scanned one row at a time. The edges that cross the row
+*  are kept sorted by x, and their x is stepped from row to row in 16.16
+*  fixed point. Each pair of crossings that encloses the inside of the
+*  polygon is drawn as one horizontal span.
+*
+*  A pixel is filled when its upper left corner is inside the polygon, so
+*  the right and bottom edges are not filled and polygons that share an edge
+*  do not overlap. GLIB_drawPolygon() with the same points draws the edges.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the polygon is drawn. The polygon is
+*  filled using the foreground color.
+*  @param numPoints
+*  Number of points in the polygon ( Has to be greater than 2, and at most
+*  GLIB_POLYGON_MAX_EDGES )
+*  @param polyPoints
+*  Pointer to array of polygon points. The points are laid out like this: polyPoints = {x1,y1,x2,y2 ... }
+*  Polypoints has to contain at least (numPoints * 2) entries. The
+*  coordinates must be less than 32768.
+*  @param fillRule
+*  GLIB_FILL_EVEN_ODD or GLIB_FILL_NON_ZERO
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawPolygonFilled(const GLIB_Context *pContext, uint32_t numPoints,
+                                const uint16_t *polyPoints, uint32_t fillRule)
+{
+  /* Check arguments */
+  if (pContext == NULL || polyPoints == NULL || numPoints < 3)
+    return GLIB_INVALID_ARGUMENT;
+  if (numPoints > GLIB_POLYGON_MAX_EDGES)
+    return GLIB_INVALID_ARGUMENT;
+  if (fillRule != GLIB_FILL_EVEN_ODD && fillRule != GLIB_FILL_NON_ZERO)
+    return GLIB_INVALID_ARGUMENT;
+
+  GLIB_PolygonEdge edges[GLIB_POLYGON_MAX_EDGES];
+  GLIB_PolygonEdge *active[GLIB_POLYGON_MAX_EDGES];
+  GLIB_PolygonEdge *pEdge;
+  EMSTATUS         status;
+  uint32_t         numEdges  = 0;
+  uint32_t         numActive = 0;
+  uint32_t         nextEdge  = 0;
+  uint32_t         didDraw   = 0;
+  uint32_t         i, j;
+  int32_t          x0, y0, x1, y1;
+  int32_t          y, yEnd;
+  int32_t          winding, xStart, xEnd;
+
+  /* Build the edge table, leaving out horizontal edges */
+  for (i = 0; i < numPoints; i++)
+  {
+    j  = (i + 1 < numPoints) ? i + 1 : 0;
+    x0 = polyPoints[2 * i];
+    y0 = polyPoints[2 * i + 1];
+    x1 = polyPoints[2 * j];
+    y1 = polyPoints[2 * j + 1];
+
+    if ((x0 > 0x7FFF) || (y0 > 0x7FFF)) return GLIB_INVALID_ARGUMENT;
+    if (y0 == y1) continue;
+
+    pEdge          = &edges[numEdges++];
+    pEdge->winding = (y0 < y1) ? 1 : -1;
+    if (y0 > y1)
+    {
+      x0 = polyPoints[2 * j];
+      y0 = polyPoints[2 * j + 1];
+      x1 = polyPoints[2 * i];
+      y1 = polyPoints[2 * i + 1];
+    }
+    pEdge->yStart = y0;
+    pEdge->yEnd   = y1;
+    pEdge->dxdy   = fixedDiv(x1 - x0, y1 - y0);
+    pEdge->x      = x0 << 16;
+  }
+
+  if (numEdges == 0) return GLIB_DID_NOT_DRAW;
+
+  /* Sort the edges by their first row */
+  sortEdges(edges, numEdges);
+
+  /* Rows of the polygon inside the clipping region */
+  y    = edges[0].yStart;
+  yEnd = 0;
+  for (i = 0; i < numEdges; i++)
+  {
+    if (edges[i].yEnd > yEnd) yEnd = edges[i].yEnd;
+  }
+  if (y < pContext->clippingRegion.yMin) y = pContext->clippingRegion.yMin;
+  if (yEnd > pContext->clippingRegion.yMax + 1) yEnd = pContext->clippingRegion.yMax + 1;
+
+  for (; y < yEnd; y++)
+  {
+    /* Drop the edges that end above this row */
+    for (i = 0, j = 0; i < numActive; i++)
+    {
+      if (active[i]->yEnd > y) active[j++] = active[i];
+    }
+    numActive = j;
+
+    /* Add the edges that start on or above this row */
+    while ((nextEdge < numEdges) && (edges[nextEdge].yStart <= y))
+    {
+      pEdge = &edges[nextEdge++];
+      if (pEdge->yEnd <= y) continue;
+
+      /* Step edges that start above the clipping region down to this row */
+      pEdge->x += pEdge->dxdy * (y - pEdge->yStart);
+      active[numActive++] = pEdge;
+    }
+
+    /* Keep the active edges sorted by x. They are nearly sorted from the
+     * previous row, so insertion sort is fast. */
+    for (i = 1; i < numActive; i++)
+    {
+      pEdge = active[i];
+      for (j = i; (j > 0) && (active[j - 1]->x > pEdge->x); j--)
+      {
+        active[j] = active[j - 1];
+      }
+      active[j] = pEdge;
+    }
+
+    /* Draw the spans between the crossings that enclose the inside */
+    winding = 0;
+    for (i = 0; i < numActive; i++)
+    {
+      if (winding == 0) xStart = active[i]->x;
+
+      if (fillRule == GLIB_FILL_EVEN_ODD)
+      {
+        winding ^= 1;
+      }
+      else
+      {
+        winding += active[i]->winding;
+      }
+
+      if (winding != 0) continue;
+
+      /* Pixels from ceil(xStart) up to, but not including, ceil(x) */
+      xStart = (xStart + 0xFFFF) >> 16;
+      xEnd   = ((active[i]->x + 0xFFFF) >> 16) - 1;
+      if (xStart < pContext->clippingRegion.xMin) xStart = pContext->clippingRegion.xMin;
+      if (xEnd > pContext->clippingRegion.xMax) xEnd = pContext->clippingRegion.xMax;
+      if (xStart > xEnd) continue;
+
+      status = GLIB_writeColor(pContext, xStart, y, xEnd - xStart + 1, 1,
+                               pContext->foregroundColor);
+      if (status != GLIB_OK) return status;
+      didDraw = 1;
+    }
+
+    /* Step the active edges to the next row */
+    for (i = 0; i < numActive; i++)
+    {
+      active[i]->x += active[i]->dxdy;
+    }
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Divides two integers into a 16.16 fixed point number, rounded down
+******************************************************************************/
+static int32_t fixedDiv(int32_t dividend, int32_t divisor)
+{
+  int32_t quotient = (dividend * 65536) / divisor;
+
+  /* C division rounds towards zero */
+  if (((dividend * 65536) % divisor != 0) && ((dividend < 0) != (divisor < 0))) quotient--;
+
+  return quotient;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sorts polygon edges by their first row
+******************************************************************************/
+static void sortEdges(GLIB_PolygonEdge *pEdges, uint32_t numEdges)
+{
+  GLIB_PolygonEdge edge;
+  uint32_t         i, j;
+
+  for (i = 1; i < numEdges; i++)
+  {
+    edge = pEdges[i];
+    for (j = i; (j > 0) && (pEdges[j - 1].yStart > edge.yStart); j--)
+    {
+      pEdges[j] = pEdges[j - 1];
+    }
+    pEdges[j] = edge;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a filled triangle.
+*
+*  The triangle is split at its middle vertex into an upper and a lower
+*  part. The long edge from the top to the bottom vertex and the short edge
+*  of each part are walked down one row at a time in 16.16 fixed point, and
+*  each row is drawn as one span. Pixels are filled by the same rule as in
+*  GLIB_drawPolygonFilled(), so triangles that share an edge do not overlap.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context in which the triangle is drawn. The triangle is
+*  filled using the foreground color.
+*  @param x0
+*  x-coordinate of the first corner
+*  @param y0
+*  y-coordinate of the first corner
+*  @param x1
+*  x-coordinate of the second corner
+*  @param y1
+*  y-coordinate of the second corner
+*  @param x2
+*  x-coordinate of the third corner
+*  @param y2
+*  y-coordinate of the third corner
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawTriangleFilled(const GLIB_Context *pContext, uint16_t x0, uint16_t y0,
+                                 uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+  if ((x0 > 0x7FFF) || (x1 > 0x7FFF) || (x2 > 0x7FFF))
+    return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+  uint32_t didDraw = 0;
+  uint16_t swap;
+  int32_t  y, yEnd;
+  int32_t  xLong, dxLong;
+  int32_t  xShort, dxShort;
+  int32_t  xStart, xEnd;
+
+  /* Sort the corners from top to bottom */
+  if (y1 < y0)
+  {
+    swap = x0; x0 = x1; x1 = swap;
+    swap = y0; y0 = y1; y1 = swap;
+  }
+  if (y2 < y1)
+  {
+    swap = x1; x1 = x2; x2 = swap;
+    swap = y1; y1 = y2; y2 = swap;
+  }
+  if (y1 < y0)
+  {
+    swap = x0; x0 = x1; x1 = swap;
+    swap = y0; y0 = y1; y1 = swap;
+  }
+
+  /* Check if the entire triangle is outside the clipping region */
+  if ((y2 <= pContext->clippingRegion.yMin) || (y0 > pContext->clippingRegion.yMax))
+    return GLIB_DID_NOT_DRAW;
+
+  /* Rows of the triangle inside the clipping region */
+  y    = (y0 < pContext->clippingRegion.yMin) ? pContext->clippingRegion.yMin : y0;
+  yEnd = (y2 > pContext->clippingRegion.yMax + 1) ? pContext->clippingRegion.yMax + 1 : y2;
+  if (y >= yEnd) return GLIB_DID_NOT_DRAW;
+
+  dxLong = fixedDiv(x2 - x0, y2 - y0);
+  xLong  = (x0 << 16) + dxLong * (y - y0);
+
+  /* The upper part uses the edge to the middle corner, the lower part the
+   * edge from it */
+  if (y < y1)
+  {
+    dxShort = fixedDiv(x1 - x0, y1 - y0);
+    xShort  = (x0 << 16) + dxShort * (y - y0);
+  }
+  else
+  {
+    dxShort = fixedDiv(x2 - x1, y2 - y1);
+    xShort  = (x1 << 16) + dxShort * (y - y1);
+  }
+
+  for (; y < yEnd; y++)
+  {
+    if (y == y1)
+    {
+      dxShort = fixedDiv(x2 - x1, y2 - y1);
+      xShort  = x1 << 16;
+    }
+
+    /* Pixels from ceil(left) up to, but not including, ceil(right) */
+    if (xLong < xShort)
+    {
+      xStart = (xLong + 0xFFFF) >> 16;
+      xEnd   = ((xShort + 0xFFFF) >> 16) - 1;
+    }
+    else
+    {
+      xStart = (xShort + 0xFFFF) >> 16;
+      xEnd   = ((xLong + 0xFFFF) >> 16) - 1;
+    }
+    if (xStart < pContext->clippingRegion.xMin) xStart = pContext->clippingRegion.xMin;
+    if (xEnd > pContext->clippingRegion.xMax) xEnd = pContext->clippingRegion.xMax;
+
+    if (xStart <= xEnd)
+    {
+      status = GLIB_writeColor(pContext, xStart, y, xEnd - xStart + 1, 1,
+                               pContext->foregroundColor);
+      if (status != GLIB_OK) return status;
+      didDraw = 1;
+    }
+
+    xLong  += dxLong;
+    xShort += dxShort;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
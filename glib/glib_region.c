@@ -0,0 +1,695 @@
+ /*************************************************************************//**
+ * @file glib_region.c
+ * @brief Energy Micro Graphics Library: Region Algebra
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/* Operations of regionOp() */
+#define REGION_UNION        0
+#define REGION_INTERSECT    1
+#define REGION_SUBTRACT     2
+
+/* Local function prototypes */
+static uint32_t bandEnd(const GLIB_Region *pRegion, uint32_t start);
+static uint32_t findBand(const GLIB_Region *pRegion, uint16_t y);
+static uint32_t addRect(GLIB_Region *pResult, int32_t xMin, int32_t xMax,
+                        int32_t yMin, int32_t yMax);
+static uint32_t bandOp(GLIB_Region *pResult, const GLIB_Rectangle *pA, uint32_t numA,
+                       const GLIB_Rectangle *pB, uint32_t numB,
+                       int32_t yMin, int32_t yMax, uint32_t op);
+static uint32_t coalesce(GLIB_Region *pResult, uint32_t prevBand, uint32_t curBand);
+static void computeExtents(GLIB_Region *pRegion);
+static EMSTATUS regionOp(GLIB_Region *pResult, const GLIB_Region *pA,
+                         const GLIB_Region *pB, uint32_t op);
+
+/**************************************************************************//**
+*  @brief
+*  Returns the index after the last rectangle of the band that starts at
+*  index start
+******************************************************************************/
+static uint32_t bandEnd(const GLIB_Region *pRegion, uint32_t start)
+{
+  uint32_t end = start + 1;
+
+  while ((end < pRegion->numRects) && (pRegion->rects[end].yMin == pRegion->rects[start].yMin))
+  {
+    end++;
+  }
+
+  return end;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the index of the first rectangle that ends on or below row y, or
+*  numRects if there is none. The bands are sorted, so yMax never decreases
+*  through the rectangles and a binary search can be used.
+******************************************************************************/
+static uint32_t findBand(const GLIB_Region *pRegion, uint16_t y)
+{
+  uint32_t low  = 0;
+  uint32_t high = pRegion->numRects;
+  uint32_t middle;
+
+  while (low < high)
+  {
+    middle = (low + high) / 2;
+    if (pRegion->rects[middle].yMax < y)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return low;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Adds a rectangle to the end of a region
+*
+*  @return
+*  Returns 1 on success, or 0 if the storage of the region is full
+******************************************************************************/
+static uint32_t addRect(GLIB_Region *pResult, int32_t xMin, int32_t xMax,
+                        int32_t yMin, int32_t yMax)
+{
+  GLIB_Rectangle *pRect;
+
+  if (pResult->numRects >= pResult->maxRects) return 0;
+
+  pRect       = &pResult->rects[pResult->numRects++];
+  pRect->xMin = xMin;
+  pRect->yMin = yMin;
+  pRect->xMax = xMax;
+  pRect->yMax = yMax;
+
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Combines the rectangles of one band of each region, and adds the result
+*  as a band from yMin to yMax. Either band may be empty. Both lists are
+*  sorted, so each is walked once.
+*
+*  @return
+*  Returns 1 on success, or 0 if the storage of the result is full
+******************************************************************************/
+static uint32_t bandOp(GLIB_Region *pResult, const GLIB_Rectangle *pA, uint32_t numA,
+                       const GLIB_Rectangle *pB, uint32_t numB,
+                       int32_t yMin, int32_t yMax, uint32_t op)
+{
+  const GLIB_Rectangle *pNext;
+  uint32_t             i = 0, j = 0;
+  uint32_t             open = 0;
+  int32_t              xMin = 0, xMax = 0, x;
+
+  if (op == REGION_UNION)
+  {
+    /* Take the rectangles in order of xMin, and merge the ones that overlap
+     * or touch */
+    while ((i < numA) || (j < numB))
+    {
+      if ((j >= numB) || ((i < numA) && (pA[i].xMin <= pB[j].xMin)))
+      {
+        pNext = &pA[i++];
+      }
+      else
+      {
+        pNext = &pB[j++];
+      }
+
+      if (open && (pNext->xMin <= xMax + 1))
+      {
+        if (pNext->xMax > xMax) xMax = pNext->xMax;
+        continue;
+      }
+
+      if (open && !addRect(pResult, xMin, xMax, yMin, yMax)) return 0;
+      xMin = pNext->xMin;
+      xMax = pNext->xMax;
+      open = 1;
+    }
+
+    if (open && !addRect(pResult, xMin, xMax, yMin, yMax)) return 0;
+  }
+  else if (op == REGION_INTERSECT)
+  {
+    while ((i < numA) && (j < numB))
+    {
+      xMin = (pA[i].xMin > pB[j].xMin) ? pA[i].xMin : pB[j].xMin;
+      xMax = (pA[i].xMax < pB[j].xMax) ? pA[i].xMax : pB[j].xMax;
+      if ((xMin <= xMax) && !addRect(pResult, xMin, xMax, yMin, yMax)) return 0;
+
+      /* Move past the rectangle that ends first */
+      if (pA[i].xMax < pB[j].xMax)
+      {
+        i++;
+      }
+      else
+      {
+        j++;
+      }
+    }
+  }
+  else
+  {
+    for (i = 0; i < numA; i++)
+    {
+      /* x is the first pixel of pA[i] not yet covered or added */
+      x = pA[i].xMin;
+
+      while ((j < numB) && (pB[j].xMin <= pA[i].xMax))
+      {
+        if (pB[j].xMax >= x)
+        {
+          if ((pB[j].xMin > x) && !addRect(pResult, x, pB[j].xMin - 1, yMin, yMax)) return 0;
+          x = pB[j].xMax + 1;
+
+          /* The rectangle may also cover part of the next one of pA */
+          if (pB[j].xMax > pA[i].xMax) break;
+        }
+        j++;
+      }
+
+      if ((x <= pA[i].xMax) && !addRect(pResult, x, pA[i].xMax, yMin, yMax)) return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Merges the band that starts at curBand into the band that starts at
+*  prevBand, if they touch and have the same rectangles
+*
+*  @return
+*  Returns the start of the last band of the result
+******************************************************************************/
+static uint32_t coalesce(GLIB_Region *pResult, uint32_t prevBand, uint32_t curBand)
+{
+  GLIB_Rectangle *pRects = pResult->rects;
+  uint32_t       count   = pResult->numRects - curBand;
+  uint32_t       i;
+
+  if (curBand - prevBand != count) return curBand;
+  if (pRects[prevBand].yMax + 1 != pRects[curBand].yMin) return curBand;
+
+  for (i = 0; i < count; i++)
+  {
+    if ((pRects[prevBand + i].xMin != pRects[curBand + i].xMin) ||
+        (pRects[prevBand + i].xMax != pRects[curBand + i].xMax))
+    {
+      return curBand;
+    }
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    pRects[prevBand + i].yMax = pRects[curBand].yMax;
+  }
+  pResult->numRects = curBand;
+
+  return prevBand;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Sets the extents of a region to the bounding box of its rectangles
+******************************************************************************/
+static void computeExtents(GLIB_Region *pRegion)
+{
+  const GLIB_Rectangle *pRects = pRegion->rects;
+  uint32_t             i;
+
+  if (pRegion->numRects == 0) return;
+
+  /* The bands are sorted from top to bottom */
+  pRegion->extents.yMin = pRects[0].yMin;
+  pRegion->extents.yMax = pRects[pRegion->numRects - 1].yMax;
+  pRegion->extents.xMin = pRects[0].xMin;
+  pRegion->extents.xMax = pRects[0].xMax;
+
+  for (i = 1; i < pRegion->numRects; i++)
+  {
+    if (pRects[i].xMin < pRegion->extents.xMin) pRegion->extents.xMin = pRects[i].xMin;
+    if (pRects[i].xMax > pRegion->extents.xMax) pRegion->extents.xMax = pRects[i].xMax;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Combines two regions band by band
+*
+*  The rows are swept from top to bottom. Each step covers the rows until
+*  the current band of either region ends or the next one starts, and
+*  combines the rectangles of both regions on those rows with bandOp().
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+static EMSTATUS regionOp(GLIB_Region *pResult, const GLIB_Region *pA,
+                         const GLIB_Region *pB, uint32_t op)
+{
+  /* Check arguments */
+  if (pResult == NULL || pA == NULL || pB == NULL) return GLIB_INVALID_ARGUMENT;
+  if (pResult->rects == pA->rects || pResult->rects == pB->rects) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_Rectangle *pRectsA = pA->rects;
+  const GLIB_Rectangle *pRectsB = pB->rects;
+  uint32_t             indexA = 0, indexB = 0;
+  uint32_t             endA, endB;
+  uint32_t             prevBand = 0, curBand;
+  uint32_t             hasBand  = 0;
+  int32_t              y = 0;
+  int32_t              topA, topB, yMin, yMax;
+  uint32_t             numA, numB;
+
+  pResult->numRects = 0;
+
+  while ((indexA < pA->numRects) || (indexB < pB->numRects))
+  {
+    /* Nothing more can be added once the region that limits the result
+     * runs out */
+    if ((op != REGION_UNION) && (indexA >= pA->numRects)) break;
+    if ((op == REGION_INTERSECT) && (indexB >= pB->numRects)) break;
+
+    topA = 0x10000;
+    topB = 0x10000;
+    if (indexA < pA->numRects) topA = (pRectsA[indexA].yMin > y) ? pRectsA[indexA].yMin : y;
+    if (indexB < pB->numRects) topB = (pRectsB[indexB].yMin > y) ? pRectsB[indexB].yMin : y;
+
+    endA = (indexA < pA->numRects) ? bandEnd(pA, indexA) : indexA;
+    endB = (indexB < pB->numRects) ? bandEnd(pB, indexB) : indexB;
+    numA = endA - indexA;
+    numB = endB - indexB;
+
+    if (topA < topB)
+    {
+      /* Rows where only pA has rectangles */
+      yMin = topA;
+      yMax = (pRectsA[indexA].yMax < topB - 1) ? pRectsA[indexA].yMax : topB - 1;
+      numB = 0;
+    }
+    else if (topB < topA)
+    {
+      /* Rows where only pB has rectangles */
+      yMin = topB;
+      yMax = (pRectsB[indexB].yMax < topA - 1) ? pRectsB[indexB].yMax : topA - 1;
+      numA = 0;
+    }
+    else
+    {
+      yMin = topA;
+      yMax = (pRectsA[indexA].yMax < pRectsB[indexB].yMax) ?
+             pRectsA[indexA].yMax : pRectsB[indexB].yMax;
+    }
+
+    curBand = pResult->numRects;
+    if (!bandOp(pResult, &pRectsA[indexA], numA, &pRectsB[indexB], numB, yMin, yMax, op))
+    {
+      pResult->numRects = 0;
+      return GLIB_OUT_OF_MEMORY;
+    }
+
+    if (pResult->numRects > curBand)
+    {
+      prevBand = hasBand ? coalesce(pResult, prevBand, curBand) : curBand;
+      hasBand  = 1;
+    }
+
+    /* Move on to the next band of the regions whose band is done */
+    y = yMax + 1;
+    if ((indexA < pA->numRects) && (pRectsA[indexA].yMax <= yMax)) indexA = endA;
+    if ((indexB < pB->numRects) && (pRectsB[indexB].yMax <= yMax)) indexB = endB;
+  }
+
+  computeExtents(pResult);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize an empty region on top of rectangle storage
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region to initialize
+*  @param rects
+*  Rectangle storage. The region never allocates memory, so operations
+*  whose result does not fit return GLIB_OUT_OF_MEMORY.
+*  @param maxRects
+*  Number of rectangles the storage holds
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionInit(GLIB_Region *pRegion, GLIB_Rectangle *rects, uint32_t maxRects)
+{
+  /* Check arguments */
+  if (pRegion == NULL || (rects == NULL && maxRects != 0)) return GLIB_INVALID_ARGUMENT;
+
+  pRegion->rects    = rects;
+  pRegion->maxRects = maxRects;
+  pRegion->numRects = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Makes a region empty
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionClear(GLIB_Region *pRegion)
+{
+  /* Check arguments */
+  if (pRegion == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pRegion->numRects = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Makes a region hold one rectangle
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region
+*  @param pRect
+*  Pointer to the rectangle
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionSetRect(GLIB_Region *pRegion, const GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pRegion == NULL || pRect == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_INVALID_ARGUMENT;
+  if (pRegion->maxRects == 0) return GLIB_OUT_OF_MEMORY;
+
+  pRegion->rects[0] = *pRect;
+  pRegion->numRects = 1;
+  pRegion->extents  = *pRect;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Copies a region into the storage of another
+*
+*  @param pResult
+*  Pointer to the GLIB_Region to copy to
+*  @param pRegion
+*  Pointer to the GLIB_Region to copy
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionCopy(GLIB_Region *pResult, const GLIB_Region *pRegion)
+{
+  /* Check arguments */
+  if (pResult == NULL || pRegion == NULL) return GLIB_INVALID_ARGUMENT;
+  if (pResult == pRegion) return GLIB_OK;
+  if (pRegion->numRects > pResult->maxRects) return GLIB_OUT_OF_MEMORY;
+
+  memmove(pResult->rects, pRegion->rects, pRegion->numRects * sizeof(GLIB_Rectangle));
+  pResult->numRects = pRegion->numRects;
+  pResult->extents  = pRegion->extents;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes the pixels that are in either of two regions
+*
+*  The result must have its own storage, not shared with pA or pB. To update
+*  a region in place, compute into a second region and swap the two.
+*
+*  @param pResult
+*  Pointer to the GLIB_Region that receives the result. It is empty if
+*  GLIB_OUT_OF_MEMORY is returned.
+*  @param pA
+*  Pointer to the first region
+*  @param pB
+*  Pointer to the second region
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionUnion(GLIB_Region *pResult, const GLIB_Region *pA, const GLIB_Region *pB)
+{
+  return regionOp(pResult, pA, pB, REGION_UNION);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes the pixels that are in both of two regions
+*
+*  The result must have its own storage, not shared with pA or pB.
+*
+*  @param pResult
+*  Pointer to the GLIB_Region that receives the result. It is empty if
+*  GLIB_OUT_OF_MEMORY is returned.
+*  @param pA
+*  Pointer to the first region
+*  @param pB
+*  Pointer to the second region
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionIntersect(GLIB_Region *pResult, const GLIB_Region *pA,
+                              const GLIB_Region *pB)
+{
+  return regionOp(pResult, pA, pB, REGION_INTERSECT);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Computes the pixels of a region that are not in another region
+*
+*  The result must have its own storage, not shared with pA or pB.
+*
+*  @param pResult
+*  Pointer to the GLIB_Region that receives the result. It is empty if
+*  GLIB_OUT_OF_MEMORY is returned.
+*  @param pA
+*  Pointer to the region to subtract from
+*  @param pB
+*  Pointer to the region to subtract
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_regionSubtract(GLIB_Region *pResult, const GLIB_Region *pA,
+                             const GLIB_Region *pB)
+{
+  return regionOp(pResult, pA, pB, REGION_SUBTRACT);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Moves a region
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region
+*  @param dx
+*  Distance to move in x-direction
+*  @param dy
+*  Distance to move in y-direction
+*
+*  @return
+*  - Returns GLIB_OK on success
+*  - Returns GLIB_OUT_OF_BOUNDS if part of the region would be moved outside
+*    the coordinate range. The region is not changed.
+*  - Returns error code otherwise
+******************************************************************************/
+EMSTATUS GLIB_regionTranslate(GLIB_Region *pRegion, int32_t dx, int32_t dy)
+{
+  /* Check arguments */
+  if (pRegion == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle *pRect;
+  uint32_t       i;
+
+  if (pRegion->numRects == 0) return GLIB_OK;
+
+  if (((int32_t) pRegion->extents.xMin + dx < 0) || ((int32_t) pRegion->extents.xMax + dx > 0xFFFF) ||
+      ((int32_t) pRegion->extents.yMin + dy < 0) || ((int32_t) pRegion->extents.yMax + dy > 0xFFFF))
+  {
+    return GLIB_OUT_OF_BOUNDS;
+  }
+
+  for (i = 0; i < pRegion->numRects; i++)
+  {
+    pRect        = &pRegion->rects[i];
+    pRect->xMin += dx;
+    pRect->yMin += dy;
+    pRect->xMax += dx;
+    pRect->yMax += dy;
+  }
+
+  pRegion->extents.xMin += dx;
+  pRegion->extents.yMin += dy;
+  pRegion->extents.xMax += dx;
+  pRegion->extents.yMax += dy;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks if a point is in a region. The band is found by a binary search,
+*  and only its rectangles are tested.
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region
+*  @param x
+*  X-coordinate of point
+*  @param y
+*  Y-coordinate of point
+*
+*  @return
+*  Returns 1 if the point is in the region, otherwise 0
+******************************************************************************/
+uint32_t GLIB_regionContainsPoint(const GLIB_Region *pRegion, uint16_t x, uint16_t y)
+{
+  /* Check arguments */
+  if (pRegion == NULL || pRegion->numRects == 0) return 0;
+
+  const GLIB_Rectangle *pRects = pRegion->rects;
+  uint32_t             i, end;
+
+  if (!GLIB_rectContainsPoint(&pRegion->extents, x, y)) return 0;
+
+  i = findBand(pRegion, y);
+  if (pRects[i].yMin > y) return 0;
+
+  for (end = bandEnd(pRegion, i); i < end; i++)
+  {
+    if (x < pRects[i].xMin) return 0;
+    if (x <= pRects[i].xMax) return 1;
+  }
+
+  return 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Checks how much of a rectangle is in a region
+*
+*  Use it to cull primitives against what is hidden, or to find out if a
+*  rectangle needs to be redrawn.
+*
+*  @param pRegion
+*  Pointer to the GLIB_Region
+*  @param pRect
+*  Pointer to the rectangle
+*
+*  @return
+*  - Returns GLIB_REGION_IN if the whole rectangle is in the region
+*  - Returns GLIB_REGION_PART if some of it is
+*  - Returns GLIB_REGION_OUT if none of it is
+******************************************************************************/
+uint32_t GLIB_regionContainsRect(const GLIB_Region *pRegion, const GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pRegion == NULL || pRect == NULL || pRegion->numRects == 0) return GLIB_REGION_OUT;
+  if ((pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_REGION_OUT;
+
+  const GLIB_Rectangle *pRects = pRegion->rects;
+  uint32_t             partIn  = 0;
+  uint32_t             partOut = 0;
+  uint32_t             i, end;
+  int32_t              x, y;
+
+  if ((pRect->xMin > pRegion->extents.xMax) || (pRect->xMax < pRegion->extents.xMin) ||
+      (pRect->yMin > pRegion->extents.yMax) || (pRect->yMax < pRegion->extents.yMin))
+  {
+    return GLIB_REGION_OUT;
+  }
+
+  /* y is the first row of the rectangle not yet checked */
+  y = pRect->yMin;
+
+  for (i = findBand(pRegion, pRect->yMin);
+       (i < pRegion->numRects) && (pRects[i].yMin <= pRect->yMax); i = end)
+  {
+    end = bandEnd(pRegion, i);
+
+    /* Rows above the band are not covered */
+    if (pRects[i].yMin > y) partOut = 1;
+
+    /* x is the first pixel of the row not yet checked */
+    x = pRect->xMin;
+    for (; (i < end) && (pRects[i].xMin <= pRect->xMax); i++)
+    {
+      if (pRects[i].xMax < x) continue;
+      if (pRects[i].xMin > x) partOut = 1;
+      partIn = 1;
+      x      = pRects[i].xMax + 1;
+    }
+    if (x <= pRect->xMax) partOut = 1;
+
+    if (partIn && partOut) return GLIB_REGION_PART;
+    y = pRects[end - 1].yMax + 1;
+  }
+
+  if (y <= pRect->yMax) partOut = 1;
+
+  if (!partIn) return GLIB_REGION_OUT;
+  return partOut ? GLIB_REGION_PART : GLIB_REGION_IN;
+}
@@ -1,197 +1,689 @@
- /*************************************************************************//**
- * @file glib_string.c
- * @brief Energy Micro Graphics Library: String Drawing Routines
- * @author Energy Micro AS
- ******************************************************************************
- * @section License
- * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
- ******************************************************************************
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented; you must not
- *    claim that you wrote the original software.
- * 2. Altered source versions must be plainly marked as such, and must not be
- *    misrepresented as being the original software.
- * 3. This notice may not be removed or altered from any source distribution.
- * 4. The source and compiled code may only be used on Energy Micro "EFM32"
- *    microcontrollers and "EFR4" radios.
- *
- * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
- * obligation to support this Software. Energy Micro AS is providing the
- * Software "AS IS", with no express or implied warranties of any kind,
- * including, but not limited to, any implied warranties of merchantability
- * or fitness for any particular purpose or warranties against infringement
- * of any proprietary rights of a third party.
- *
- * Energy Micro AS will not be liable for any consequential, incidental, or
- * special damages, or any other relief, or for any claim by any third party,
- * arising from your use of this Software.
- *
- *****************************************************************************/
-
-/* Standard C header files */
-#include <stdint.h>
-/* EM types */
-#include "em_types.h"
-
-/* GLIB header files */
-#include "glib.h"
-#include "glib_font.h"
-#include "glib_color.h"
-
-/* Defines */
-/* Sets how many pixels it should be between each line */
-#define SPACE_BETWEEN_LINES    (2)
-#define FONT_ROW_OFFSET        (100)
-
-/**************************************************************************//**
-*  @brief
-*  Draws a char using the font supplied with the library.
-*
-*  @param pContext
-*  Pointer to the GLIB_Context
-*
-*  @param myChar
-*  Char to be drawn
-*
-*  @param x0
-*  Start x-coordinate for the char (Upper left corner)
-*
-*  @param y0
-*  Start y-coordinate for the char (Upper left corner)
-*
-*  @param opaque
-*  Determines whether to show the background or color it with the background
-*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawChar(const GLIB_Context *pContext, char myChar, uint16_t x, uint16_t y,
-                       uint32_t opaque)
-{
-  /* Check arguments */
-  if (pContext == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  /* Check input char */
-  if ((myChar < ' ') || (myChar > '~'))
-  {
-    /* Invalid char */
-    return GLIB_INVALID_CHAR;
-  }
-
-  /* Check against clipping region */
-  if (GLIB_rectContainsPoint(&pContext->clippingRegion, x, y) == 0)
-  {
-    /* Do not draw if the char is outside of clipping region */
-    return GLIB_DID_NOT_DRAW;
-  }
-
-  /* Index for fontData */
-  uint16_t fontIdx;
-
-  /* Sets the index in the font array */
-  fontIdx = myChar - ' ';
-
-  uint16_t row;
-  /* Loop through the rows and draw the char */
-  for (row = 0; row < font_height; row++)
-  {
-    /* Draw current row */
-    uint8_t currentRow;
-    currentRow = fontBits[fontIdx];
-
-    uint16_t xOffset;
-    for (xOffset = 0; xOffset < font_width; ++xOffset)
-    {
-      /* Bit 1 means draw, Bit 0 means do not draw */
-      if ((currentRow & 1) == 1)
-      {
-        /* Draw pixel */
-        GLIB_drawPixel(pContext, x + xOffset, y + row);
-      }
-      else if (opaque == 1)
-      {
-        /* Draw background pixel */
-        GLIB_drawPixelColor(pContext, x + xOffset, y + row, pContext->backgroundColor);
-      }
-
-      currentRow >>= 1;
-    }
-
-    /* fontIdx offset for a new row */
-    fontIdx += FONT_ROW_OFFSET;
-  }
-
-  return GLIB_OK;
-}
-
-/**************************************************************************//**
-*  @brief
-*  Draws a string using the font supplied with the library.
-*
-*  @param pContext
-*  Pointer to a GLIB_Context
-*
-*  @param pString
-*  Pointer to the string that is drawn
-*
-*  @param x0
-*  Start x-coordinate for the string (Upper left corner)
-*
-*  @param y0
-*  Start y-coordinate for the string (Upper left corner)
-*
-*  @param opaque
-*  Determines whether to show the background or color it with the background
-*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
-*
-*  @return
-*  Returns GLIB_OK on success, or else error code
-******************************************************************************/
-
-EMSTATUS GLIB_drawString(const GLIB_Context *pContext, char* pString, uint16_t sLength,
-                         uint16_t x0, uint16_t y0, uint32_t opaque)
-{
-  /* Check arguments */
-  if (pContext == NULL || pString == NULL)
-    return GLIB_INVALID_ARGUMENT;
-
-  EMSTATUS tmpStatus;
-  uint32_t didDraw = 0;
-
-  /* Index for string */
-  uint16_t idx;
-
-  uint16_t x, y;
-  x = x0;
-  y = y0;
-
-  /* Loops through the string and prints char for char */
-  for (idx = 0; idx < sLength; idx++)
-  {
-    /* Special case: Newline char */
-    if (pString[idx] == '\n')
-    {
-      x = x0;
-      y = y + font_height + SPACE_BETWEEN_LINES;
-      continue;
-    }
-
-    /* Prints the current char */
-    tmpStatus = GLIB_drawChar(pContext, pString[idx], x, y, opaque);
-    if (tmpStatus != 0 && tmpStatus != GLIB_DID_NOT_DRAW) return tmpStatus;
-    if (!didDraw && tmpStatus == 0) didDraw = 1;
-
-    /* Adjust x and y coordinate */
-    x += font_width;
-  }
-
-  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
-  return GLIB_OK;
-}
+ /*************************************************************************//**
+ * @file glib_string.c
+ * @brief Energy Micro Graphics Library: String Drawing Routines
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+#include "glib_font_glyphs.h"
+#include "glib_color.h"
+
+/* Defines */
+/* Sets how many pixels it should be between each line */
+#define SPACE_BETWEEN_LINES    (2)
+#define font_width             fontGlyphs_WIDTH
+#define font_height            fontGlyphs_HEIGHT
+
+/* Gets one row of a glyph from its words in fontGlyphs */
+#define GLYPH_ROW(pWords, row)    (((pWords)[(row) >> 2] >> (((row) & 3) * 8)) & 0xFF)
+
+#if GLIB_GLYPH_CACHE_MAX_PIXELS < font_width * font_height
+#error "GLIB_GLYPH_CACHE_MAX_PIXELS is too small for the font"
+#endif
+
+/* Local function prototypes */
+static void fontMetrics(const GLIB_Font *pFont, uint16_t *pHeight, uint16_t *pLineHeight);
+static EMSTATUS charAdvance(const GLIB_Font *pFont, const char *pString, uint16_t idx,
+                            uint16_t lineStart, int32_t *pAdvance);
+
+/**************************************************************************//**
+*  @brief
+*  Draws a char using the font supplied with the library.
+*
+*  @param pContext
+*  Pointer to the GLIB_Context
+*
+*  @param myChar
+*  Char to be drawn
+*
+*  @param x0
+*  Start x-coordinate for the char (Upper left corner)
+*
+*  @param y0
+*  Start y-coordinate for the char (Upper left corner)
+*
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawChar(const GLIB_Context *pContext, char myChar, uint16_t x, uint16_t y,
+                       uint32_t opaque)
+{
+  /* Check arguments */
+  if (pContext == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  /* Check input char */
+  if ((myChar < ' ') || (myChar > '~'))
+  {
+    /* Invalid char */
+    return GLIB_INVALID_CHAR;
+  }
+
+  /* Check against clipping region */
+  if ((x > pContext->clippingRegion.xMax) || (y > pContext->clippingRegion.yMax) ||
+      ((int32_t) x + font_width <= pContext->clippingRegion.xMin) ||
+      ((int32_t) y + font_height <= pContext->clippingRegion.yMin))
+  {
+    /* Do not draw if the char is outside of clipping region */
+    return GLIB_DID_NOT_DRAW;
+  }
+
+  /* Part of the char that is inside the clipping region, relative to x, y */
+  uint16_t colMin = (x < pContext->clippingRegion.xMin) ? pContext->clippingRegion.xMin - x : 0;
+  uint16_t rowMin = (y < pContext->clippingRegion.yMin) ? pContext->clippingRegion.yMin - y : 0;
+  uint16_t colMax = font_width - 1;
+  uint16_t rowMax = font_height - 1;
+  if ((int32_t) x + colMax > pContext->clippingRegion.xMax) colMax = pContext->clippingRegion.xMax - x;
+  if ((int32_t) y + rowMax > pContext->clippingRegion.yMax) rowMax = pContext->clippingRegion.yMax - y;
+
+  /* The glyph is two words, each holding four rows */
+  const uint32_t *pWords = &fontGlyphs[(myChar - ' ') * fontGlyphs_WORDS_PER_GLYPH];
+
+  EMSTATUS status;
+  uint16_t row;
+  uint16_t col;
+  uint8_t  currentRow;
+
+  if (opaque == 1)
+  {
+    uint32_t pixels[font_width * font_height];
+
+    /* Draw glyphs that are not clipped from the glyph cache */
+    if ((pContext->pGlyphCache != NULL) && (rowMin == 0) && (colMin == 0) &&
+        (rowMax == font_height - 1) && (colMax == font_width - 1) &&
+        (font_width * font_height <= GLIB_GLYPH_CACHE_MAX_PIXELS))
+    {
+      const uint16_t *pCached;
+      uint16_t       *pEntry;
+
+      pCached = GLIB_glyphCacheLookup(pContext->pGlyphCache, fontGlyphs, myChar,
+                                      pContext->foregroundColor,
+                                      pContext->backgroundColor);
+      if (pCached == NULL)
+      {
+        /* Render the glyph straight into a new cache entry */
+        uint16_t foreground = GLIB_colorTranslateRGB565(pContext->foregroundColor);
+        uint16_t background = GLIB_colorTranslateRGB565(pContext->backgroundColor);
+        uint32_t word, bits, bit;
+
+        pEntry  = GLIB_glyphCacheInsert(pContext->pGlyphCache, fontGlyphs, myChar,
+                                        pContext->foregroundColor,
+                                        pContext->backgroundColor);
+        pCached = pEntry;
+        for (word = 0; word < fontGlyphs_WORDS_PER_GLYPH; word++)
+        {
+          bits = pWords[word];
+          for (bit = 0; bit < 32; bit++)
+          {
+            *pEntry++ = (bits & 1) ? foreground : background;
+            bits    >>= 1;
+          }
+        }
+      }
+
+      return GLIB_writeDataRGB565(pContext, x, y, font_width, font_height, pCached);
+    }
+
+    /* Expand the visible part of the char into pixels and write it in one
+     * burst. Bit 1 means foreground, Bit 0 means background. */
+    uint32_t foreground = GLIB_colorNative(pContext, pContext->foregroundColor);
+    uint32_t background = GLIB_colorNative(pContext, pContext->backgroundColor);
+    uint32_t *pPixel    = pixels;
+
+    if ((rowMin == 0) && (colMin == 0) &&
+        (rowMax == font_height - 1) && (colMax == font_width - 1))
+    {
+      /* The bits of each word are the pixels of four rows in drawing order */
+      uint32_t word, bits, bit;
+      for (word = 0; word < fontGlyphs_WORDS_PER_GLYPH; word++)
+      {
+        bits = pWords[word];
+        for (bit = 0; bit < 32; bit++)
+        {
+          *pPixel++ = (bits & 1) ? foreground : background;
+          bits    >>= 1;
+        }
+      }
+    }
+    else
+    {
+      for (row = rowMin; row <= rowMax; row++)
+      {
+        currentRow = GLYPH_ROW(pWords, row) >> colMin;
+        for (col = colMin; col <= colMax; col++)
+        {
+          *pPixel++    = (currentRow & 1) ? foreground : background;
+          currentRow >>= 1;
+        }
+      }
+    }
+
+    return GLIB_writeDataNative(pContext, x + colMin, y + rowMin,
+                                colMax - colMin + 1, rowMax - rowMin + 1, pixels);
+  }
+
+  /* Loop through the rows and draw each run of set bits as one line */
+  for (row = rowMin; row <= rowMax; row++)
+  {
+    currentRow = GLYPH_ROW(pWords, row) >> colMin;
+    col        = colMin;
+
+    while (currentRow != 0 && col <= colMax)
+    {
+      /* Skip the bits that are not drawn */
+      while ((currentRow & 1) == 0)
+      {
+        currentRow >>= 1;
+        col++;
+      }
+      if (col > colMax) break;
+
+      /* Find the end of the run */
+      uint16_t runStart = col;
+      while ((currentRow & 1) == 1 && col <= colMax)
+      {
+        currentRow >>= 1;
+        col++;
+      }
+
+      status = GLIB_writeColor(pContext, x + runStart, y + row, col - runStart, 1,
+                               pContext->foregroundColor);
+      if (status != GLIB_OK) return status;
+    }
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws a string using the font supplied with the library.
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*
+*  @param pString
+*  Pointer to the string that is drawn
+*
+*  @param x0
+*  Start x-coordinate for the string (Upper left corner)
+*
+*  @param y0
+*  Start y-coordinate for the string (Upper left corner)
+*
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+
+EMSTATUS GLIB_drawString(const GLIB_Context *pContext, char* pString, uint16_t sLength,
+                         uint16_t x0, uint16_t y0, uint32_t opaque)
+{
+  /* Check arguments */
+  if (pContext == NULL || pString == NULL)
+    return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS tmpStatus;
+  uint32_t didDraw = 0;
+
+  /* Index for string */
+  uint16_t idx;
+
+  int32_t x, y;
+  x = x0;
+  y = y0;
+
+  /* Loops through the string and prints char for char */
+  for (idx = 0; idx < sLength; idx++)
+  {
+    /* Special case: Newline char */
+    if (pString[idx] == '\n')
+    {
+      x = x0;
+      y = y + font_height + SPACE_BETWEEN_LINES;
+      continue;
+    }
+
+    /* Chars outside the clipping region are only checked, not drawn */
+    if ((y > pContext->clippingRegion.yMax) ||
+        (y + font_height <= pContext->clippingRegion.yMin) ||
+        (x > pContext->clippingRegion.xMax) ||
+        (x + font_width <= pContext->clippingRegion.xMin))
+    {
+      if ((pString[idx] < ' ') || (pString[idx] > '~')) return GLIB_INVALID_CHAR;
+      x += font_width;
+      continue;
+    }
+
+    /* Prints the current char */
+    tmpStatus = GLIB_drawChar(pContext, pString[idx], x, y, opaque);
+    if (tmpStatus != 0 && tmpStatus != GLIB_DID_NOT_DRAW) return tmpStatus;
+    if (!didDraw && tmpStatus == 0) didDraw = 1;
+
+    /* Adjust x and y coordinate */
+    x += font_width;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the height of the chars of a font and the vertical distance from one
+*  line of text to the next. A NULL font is the font supplied with the library.
+******************************************************************************/
+static void fontMetrics(const GLIB_Font *pFont, uint16_t *pHeight, uint16_t *pLineHeight)
+{
+  if (pFont == NULL)
+  {
+    *pHeight     = font_height;
+    *pLineHeight = font_height + SPACE_BETWEEN_LINES;
+    return;
+  }
+
+  *pHeight     = pFont->height;
+  *pLineHeight = pFont->height + pFont->lineSpacing;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the distance that the char at idx moves the pen, including the
+*  kerning with the char before it if that is on the same line
+*
+*  @param lineStart
+*  Index of the first char of the line
+*
+*  @return
+*  Returns GLIB_OK, or GLIB_INVALID_CHAR if the font does not have the char
+******************************************************************************/
+static EMSTATUS charAdvance(const GLIB_Font *pFont, const char *pString, uint16_t idx,
+                            uint16_t lineStart, int32_t *pAdvance)
+{
+  const GLIB_Glyph *pGlyph;
+
+  if (pFont == NULL)
+  {
+    if ((pString[idx] < ' ') || (pString[idx] > '~')) return GLIB_INVALID_CHAR;
+    *pAdvance = font_width;
+    return GLIB_OK;
+  }
+
+  pGlyph = GLIB_fontGlyph(pFont, pString[idx]);
+  if (pGlyph == NULL) return GLIB_INVALID_CHAR;
+
+  *pAdvance = pGlyph->advance;
+  if (idx > lineStart) *pAdvance += GLIB_fontKerning(pFont, pString[idx - 1], pString[idx]);
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Measures the size of a string as drawn by GLIB_drawString() or
+*  GLIB_drawStringFont(). The width is the widest line, summing the advances
+*  and kerning of its chars. Each newline starts a new line.
+*
+*  @param pFont
+*  Pointer to the font, or NULL for the font supplied with the library
+*  @param pString
+*  Pointer to the string that is measured
+*  @param sLength
+*  Number of characters in the string
+*  @param pWidth
+*  Set to the width of the string in pixels
+*  @param pHeight
+*  Set to the height of the string in pixels
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_measureString(const GLIB_Font *pFont, const char *pString, uint16_t sLength,
+                            uint16_t *pWidth, uint16_t *pHeight)
+{
+  /* Check arguments */
+  if (pString == NULL || pWidth == NULL || pHeight == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+  uint16_t fontHeight, lineHeight;
+  uint16_t idx;
+  uint16_t lineStart = 0;
+  int32_t  advance;
+  int32_t  width     = 0;
+  int32_t  maxWidth  = 0;
+  int32_t  height;
+
+  fontMetrics(pFont, &fontHeight, &lineHeight);
+  height = fontHeight;
+
+  for (idx = 0; idx < sLength; idx++)
+  {
+    if (pString[idx] == '\n')
+    {
+      height   += lineHeight;
+      width     = 0;
+      lineStart = idx + 1;
+      continue;
+    }
+
+    status = charAdvance(pFont, pString, idx, lineStart, &advance);
+    if (status != GLIB_OK) return status;
+
+    width += advance;
+    if (width > maxWidth) maxWidth = width;
+  }
+
+  *pWidth  = (maxWidth > 0xFFFF) ? 0xFFFF : maxWidth;
+  *pHeight = (height > 0xFFFF) ? 0xFFFF : height;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initializes a GLIB_TextLayout with a buffer for its lines
+*
+*  @param pLayout
+*  Pointer to the GLIB_TextLayout
+*  @param pLines
+*  Buffer for the lines of the layout
+*  @param maxLines
+*  Number of lines in the buffer
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_textLayoutInit(GLIB_TextLayout *pLayout, GLIB_TextLine *pLines,
+                             uint16_t maxLines)
+{
+  /* Check arguments */
+  if (pLayout == NULL || pLines == NULL || maxLines == 0) return GLIB_INVALID_ARGUMENT;
+
+  pLayout->pFont      = NULL;
+  pLayout->pString    = NULL;
+  pLayout->pLines     = pLines;
+  pLayout->maxLines   = maxLines;
+  pLayout->numLines   = 0;
+  pLayout->lineHeight = 0;
+  pLayout->end        = 0;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Breaks a string into lines that fit the width of a rectangle. Lines are
+*  wrapped at the last space that fits, or inside a word that is wider than
+*  the rectangle. The spaces at a wrap are dropped. Lines are added until the
+*  string ends, the rectangle is full or the line buffer is full, and the
+*  end field tells how much of the string was laid out.
+*
+*  @param pLayout
+*  Pointer to the GLIB_TextLayout
+*  @param pFont
+*  Pointer to the font, or NULL for the font supplied with the library
+*  @param pString
+*  Pointer to the string. It is not copied, so it must stay valid for as
+*  long as the layout is used.
+*  @param sLength
+*  Number of characters in the string
+*  @param pBox
+*  Rectangle to lay out the string in
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code. On error the layout has
+*  no lines.
+******************************************************************************/
+EMSTATUS GLIB_textLayoutSet(GLIB_TextLayout *pLayout, const GLIB_Font *pFont,
+                            const char *pString, uint16_t sLength,
+                            const GLIB_Rectangle *pBox)
+{
+  /* Check arguments */
+  if (pLayout == NULL || pString == NULL || pBox == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pBox->xMax < pBox->xMin) || (pBox->yMax < pBox->yMin)) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_TextLine *pLine;
+  EMSTATUS      status;
+  uint16_t      fontHeight;
+  uint16_t      idx = 0;
+  uint16_t      lineEnd, next;
+  int32_t       breakAt, breakWidth;
+  int32_t       advance, width;
+  int32_t       boxWidth = pBox->xMax - pBox->xMin + 1;
+  int32_t       y        = pBox->yMin;
+
+  fontMetrics(pFont, &fontHeight, &pLayout->lineHeight);
+  pLayout->pFont    = pFont;
+  pLayout->pString  = pString;
+  pLayout->box      = *pBox;
+  pLayout->numLines = 0;
+
+  while ((idx < sLength) && (pLayout->numLines < pLayout->maxLines) &&
+         (y + fontHeight - 1 <= pBox->yMax))
+  {
+    width      = 0;
+    breakAt    = -1;
+    breakWidth = 0;
+    lineEnd    = idx;
+
+    /* Add chars until the end of the paragraph or until one does not fit */
+    while ((lineEnd < sLength) && (pString[lineEnd] != '\n'))
+    {
+      status = charAdvance(pFont, pString, lineEnd, idx, &advance);
+      if (status != GLIB_OK)
+      {
+        /* Leave an empty layout rather than a partial one */
+        pLayout->numLines = 0;
+        pLayout->end      = 0;
+        return status;
+      }
+
+      if ((pString[lineEnd] == ' ') && (lineEnd > idx))
+      {
+        breakAt    = lineEnd;
+        breakWidth = width;
+      }
+      if ((width + advance > boxWidth) && (lineEnd > idx)) break;
+
+      width += advance;
+      lineEnd++;
+    }
+
+    if ((lineEnd < sLength) && (pString[lineEnd] != '\n'))
+    {
+      /* Wrap at the last run of spaces, dropping the whole run from both
+       * lines */
+      if (breakAt >= 0)
+      {
+        lineEnd = breakAt;
+        width   = breakWidth;
+      }
+      while ((lineEnd > idx) && (pString[lineEnd - 1] == ' '))
+      {
+        /* The spaces were measured above, so this cannot fail */
+        lineEnd--;
+        charAdvance(pFont, pString, lineEnd, idx, &advance);
+        width -= advance;
+      }
+      next = lineEnd;
+      while ((next < sLength) && (pString[next] == ' ')) next++;
+      if ((next < sLength) && (pString[next] == '\n')) next++;
+    }
+    else
+    {
+      /* Skip the newline that ends the paragraph */
+      next = (lineEnd < sLength) ? lineEnd + 1 : lineEnd;
+    }
+
+    pLine         = &pLayout->pLines[pLayout->numLines++];
+    pLine->start  = idx;
+    pLine->length = lineEnd - idx;
+    pLine->width  = (width > 0xFFFF) ? 0xFFFF : width;
+
+    idx = next;
+    y  += pLayout->lineHeight;
+  }
+
+  pLayout->end = idx;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Gets the position of a char of a GLIB_TextLayout. A char that was dropped
+*  at a wrap or a newline is placed after the end of its line.
+*
+*  @param pLayout
+*  Pointer to the GLIB_TextLayout
+*  @param index
+*  Index of the char in the string
+*  @param pX
+*  Set to the x-coordinate of the upper left corner of the char
+*  @param pY
+*  Set to the y-coordinate of the upper left corner of the char
+*
+*  @return
+*  Returns GLIB_OK on success, GLIB_INVALID_ARGUMENT if the char is not in
+*  the layout, or GLIB_INVALID_CHAR if the string has changed to hold a char
+*  that the font does not have
+******************************************************************************/
+EMSTATUS GLIB_textLayoutPosition(const GLIB_TextLayout *pLayout, uint16_t index,
+                                 uint16_t *pX, uint16_t *pY)
+{
+  /* Check arguments */
+  if (pLayout == NULL || pX == NULL || pY == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pLayout->numLines == 0) || (index >= pLayout->end)) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_TextLine *pLine;
+  uint16_t            line = 0;
+  EMSTATUS            status;
+  uint16_t            idx, lineEnd;
+  int32_t             advance = 0;
+  int32_t             x;
+
+  /* Find the last line that starts at or before the char */
+  while ((line + 1 < pLayout->numLines) && (pLayout->pLines[line + 1].start <= index))
+  {
+    line++;
+  }
+  pLine = &pLayout->pLines[line];
+
+  lineEnd = pLine->start + pLine->length;
+  if (index > lineEnd) index = lineEnd;
+
+  /* Sum the advances of the chars before it, and its kerning with them */
+  x = pLayout->box.xMin;
+  for (idx = pLine->start; idx < index; idx++)
+  {
+    status = charAdvance(pLayout->pFont, pLayout->pString, idx, pLine->start, &advance);
+    if (status != GLIB_OK) return status;
+
+    x += advance;
+  }
+  if ((pLayout->pFont != NULL) && (index > pLine->start) && (index < lineEnd))
+  {
+    x += GLIB_fontKerning(pLayout->pFont, pLayout->pString[index - 1],
+                          pLayout->pString[index]);
+  }
+
+  *pX = (x < 0) ? 0 : ((x > 0xFFFF) ? 0xFFFF : x);
+  *pY = pLayout->box.yMin + line * pLayout->lineHeight;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the lines of a GLIB_TextLayout
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pLayout
+*  Pointer to the GLIB_TextLayout
+*  @param opaque
+*  Determines whether to show the background or color it with the background
+*  color specified by the GLIB_Context. If opaque == 1, the background color is used.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_drawTextLayout(const GLIB_Context *pContext, const GLIB_TextLayout *pLayout,
+                             uint32_t opaque)
+{
+  /* Check arguments */
+  if (pContext == NULL || pLayout == NULL) return GLIB_INVALID_ARGUMENT;
+
+  const GLIB_TextLine *pLine;
+  EMSTATUS            status;
+  uint32_t            didDraw = 0;
+  uint16_t            line;
+  int32_t             y = pLayout->box.yMin;
+
+  for (line = 0; line < pLayout->numLines; line++, y += pLayout->lineHeight)
+  {
+    pLine = &pLayout->pLines[line];
+
+    /* The lines below the clipping region are not drawn */
+    if (y > pContext->clippingRegion.yMax) break;
+    if (pLine->length == 0) continue;
+
+    if (pLayout->pFont == NULL)
+    {
+      status = GLIB_drawString(pContext, (char *) &pLayout->pString[pLine->start],
+                               pLine->length, pLayout->box.xMin, y, opaque);
+    }
+    else
+    {
+      status = GLIB_drawStringFont(pContext, pLayout->pFont, &pLayout->pString[pLine->start],
+                                   pLine->length, pLayout->box.xMin, y, opaque);
+    }
+    if (status != GLIB_OK && status != GLIB_DID_NOT_DRAW) return status;
+    if (status == GLIB_OK) didDraw = 1;
+  }
+
+  if (didDraw == 0) return GLIB_DID_NOT_DRAW;
+  return GLIB_OK;
+}
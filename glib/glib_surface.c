@@ -0,0 +1,426 @@
+ /*************************************************************************//**
+ * @file glib_surface.c
+ * @brief Energy Micro Graphics Library: Off-screen Surfaces
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Standard C header files */
+#include <stdint.h>
+#include <string.h>
+
+/* EM types */
+#include "em_types.h"
+
+/* GLIB header files */
+#include "glib.h"
+
+/**************************************************************************//**
+*  @brief
+*  Intersects a rectangle given by position and size with the area of a
+*  surface
+*
+*  @return
+*  Returns 1 if the intersection is not empty, otherwise 0
+******************************************************************************/
+static uint32_t clipToSurface(const GLIB_Surface *pSurface,
+                              uint16_t x, uint16_t y,
+                              uint16_t width, uint16_t height,
+                              GLIB_Rectangle *pResult)
+{
+  int32_t xMax = (int32_t) x + width - 1;
+  int32_t yMax = (int32_t) y + height - 1;
+
+  if (width == 0 || height == 0) return 0;
+
+  if (x > pSurface->area.xMax || y > pSurface->area.yMax) return 0;
+  if (xMax < pSurface->area.xMin || yMax < pSurface->area.yMin) return 0;
+
+  pResult->xMin = (x < pSurface->area.xMin) ? pSurface->area.xMin : x;
+  pResult->yMin = (y < pSurface->area.yMin) ? pSurface->area.yMin : y;
+  pResult->xMax = (xMax > pSurface->area.xMax) ? pSurface->area.xMax : xMax;
+  pResult->yMax = (yMax > pSurface->area.yMax) ? pSurface->area.yMax : yMax;
+
+  return 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize a surface on top of a pixel buffer
+*
+*  @param pSurface
+*  Pointer to the GLIB_Surface to initialize
+*  @param pixels
+*  Pixel buffer. It must hold at least stride * (height - 1) + width pixels,
+*  where width and height are the size of pArea.
+*  @param stride
+*  Number of pixels from the start of one row to the start of the next
+*  @param pArea
+*  Display area covered by the surface
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceInit(GLIB_Surface *pSurface, uint16_t *pixels,
+                          uint16_t stride, const GLIB_Rectangle *pArea)
+{
+  /* Check arguments */
+  if (pSurface == NULL || pixels == NULL || pArea == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pArea->xMin > pArea->xMax) || (pArea->yMin > pArea->yMax)) return GLIB_INVALID_ARGUMENT;
+  if (stride < pArea->xMax - pArea->xMin + 1) return GLIB_INVALID_ARGUMENT;
+
+  pSurface->pixels = pixels;
+  pSurface->stride = stride;
+  pSurface->area   = *pArea;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Initialize a surface that shares the pixels of a part of another surface
+*
+*  @param pSub
+*  Pointer to the GLIB_Surface to initialize
+*  @param pParent
+*  Pointer to the surface that owns the pixel buffer
+*  @param pArea
+*  Display area covered by the new surface. Must be inside the area of the
+*  parent surface.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceInitSub(GLIB_Surface *pSub, const GLIB_Surface *pParent,
+                             const GLIB_Rectangle *pArea)
+{
+  /* Check arguments */
+  if (pSub == NULL || pParent == NULL || pArea == NULL) return GLIB_INVALID_ARGUMENT;
+  if ((pArea->xMin > pArea->xMax) || (pArea->yMin > pArea->yMax)) return GLIB_INVALID_ARGUMENT;
+
+  if ((pArea->xMin < pParent->area.xMin) || (pArea->xMax > pParent->area.xMax) ||
+      (pArea->yMin < pParent->area.yMin) || (pArea->yMax > pParent->area.yMax))
+  {
+    return GLIB_OUT_OF_BOUNDS;
+  }
+
+  pSub->pixels = pParent->pixels +
+                 (uint32_t) (pArea->yMin - pParent->area.yMin) * pParent->stride +
+                 (pArea->xMin - pParent->area.xMin);
+  pSub->stride = pParent->stride;
+  pSub->area   = *pArea;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Make the GLIB_Context draw into a surface instead of the display
+*
+*  @param pContext
+*  Pointer to a GLIB_Context
+*  @param pSurface
+*  Pointer to the surface, or NULL to draw directly to the display again
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_setSurface(GLIB_Context *pContext, GLIB_Surface *pSurface)
+{
+  /* Check arguments */
+  if (pContext == NULL) return GLIB_INVALID_ARGUMENT;
+
+  pContext->pSurface = pSurface;
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Fills a rectangle of a surface with one color. Coordinates are display
+*  coordinates, and the parts outside the surface are ignored.
+*
+*  @param pSurface
+*  Pointer to the surface
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param color
+*  24-bit RGB color
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceFill(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                          uint16_t width, uint16_t height, uint32_t color)
+{
+  /* Check arguments */
+  if (pSurface == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle rect;
+  if (!clipToSurface(pSurface, x, y, width, height, &rect)) return GLIB_OK;
+
+  uint16_t pixel = GLIB_colorTranslateRGB565(color);
+  uint16_t *row  = pSurface->pixels +
+                   (uint32_t) (rect.yMin - pSurface->area.yMin) * pSurface->stride +
+                   (rect.xMin - pSurface->area.xMin);
+  uint16_t xPos, yPos;
+
+  for (yPos = rect.yMin; yPos <= rect.yMax; yPos++)
+  {
+    for (xPos = 0; xPos <= rect.xMax - rect.xMin; xPos++)
+    {
+      row[xPos] = pixel;
+    }
+    row += pSurface->stride;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of 24-bit RGB pixels to a surface. Coordinates are
+*  display coordinates, and the parts outside the surface are ignored.
+*
+*  @param pSurface
+*  Pointer to the surface
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param picData
+*  Pixel data, organized as { R, G, B, R, G, B ... }
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceWrite(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                           uint16_t width, uint16_t height, const uint8_t *picData)
+{
+  /* Check arguments */
+  if (pSurface == NULL || picData == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle rect;
+  if (!clipToSurface(pSurface, x, y, width, height, &rect)) return GLIB_OK;
+
+  uint16_t *row = pSurface->pixels +
+                  (uint32_t) (rect.yMin - pSurface->area.yMin) * pSurface->stride +
+                  (rect.xMin - pSurface->area.xMin);
+  const uint8_t *src;
+  uint16_t xPos, yPos;
+
+  for (yPos = rect.yMin; yPos <= rect.yMax; yPos++)
+  {
+    src = picData + 3 * ((uint32_t) (yPos - y) * width + (rect.xMin - x));
+    for (xPos = 0; xPos <= rect.xMax - rect.xMin; xPos++)
+    {
+      row[xPos] = ((src[0] >> 3) << 11) | ((src[1] >> 2) << 5) | (src[2] >> 3);
+      src += 3;
+    }
+    row += pSurface->stride;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of RGB565 pixels to a surface, one pixel per 32-bit
+*  word as returned by GLIB_colorNative() while the surface is set.
+*  Coordinates are display coordinates, and the parts outside the surface
+*  are ignored.
+*
+*  @param pSurface
+*  Pointer to the surface
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param data
+*  Pixel data, row by row
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceWriteNative(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height, const uint32_t *data)
+{
+  /* Check arguments */
+  if (pSurface == NULL || data == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle rect;
+  if (!clipToSurface(pSurface, x, y, width, height, &rect)) return GLIB_OK;
+
+  uint16_t *row = pSurface->pixels +
+                  (uint32_t) (rect.yMin - pSurface->area.yMin) * pSurface->stride +
+                  (rect.xMin - pSurface->area.xMin);
+  const uint32_t *src;
+  uint16_t xPos, yPos;
+
+  for (yPos = rect.yMin; yPos <= rect.yMax; yPos++)
+  {
+    src = data + (uint32_t) (yPos - y) * width + (rect.xMin - x);
+    for (xPos = 0; xPos <= rect.xMax - rect.xMin; xPos++)
+    {
+      row[xPos] = (uint16_t) src[xPos];
+    }
+    row += pSurface->stride;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes a rectangle of packed RGB565 pixels to a surface. Coordinates are
+*  display coordinates, and the parts outside the surface are ignored.
+*
+*  @param pSurface
+*  Pointer to the surface
+*  @param x
+*  X-coordinate of the upper left corner
+*  @param y
+*  Y-coordinate of the upper left corner
+*  @param width
+*  Width of the rectangle
+*  @param height
+*  Height of the rectangle
+*  @param data
+*  Pixel data, row by row
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_surfaceWriteRGB565(const GLIB_Surface *pSurface, uint16_t x, uint16_t y,
+                                 uint16_t width, uint16_t height, const uint16_t *data)
+{
+  /* Check arguments */
+  if (pSurface == NULL || data == NULL) return GLIB_INVALID_ARGUMENT;
+
+  GLIB_Rectangle rect;
+  if (!clipToSurface(pSurface, x, y, width, height, &rect)) return GLIB_OK;
+
+  uint16_t *row = pSurface->pixels +
+                  (uint32_t) (rect.yMin - pSurface->area.yMin) * pSurface->stride +
+                  (rect.xMin - pSurface->area.xMin);
+  uint16_t yPos;
+
+  for (yPos = rect.yMin; yPos <= rect.yMax; yPos++)
+  {
+    memcpy(row, data + (uint32_t) (yPos - y) * width + (rect.xMin - x),
+           (rect.xMax - rect.xMin + 1) * sizeof(uint16_t));
+    row += pSurface->stride;
+  }
+
+  return GLIB_OK;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Pushes the pixels of a surface to the display. The display window is set
+*  up once and the rows are streamed back to back.
+*
+*  @param pSurface
+*  Pointer to the surface
+*  @param pRect
+*  Display area to flush, or NULL to flush the whole surface. It is clipped
+*  to the area of the surface.
+*
+*  @return
+*  Returns GLIB_OK on success, or else error code
+******************************************************************************/
+EMSTATUS GLIB_flushSurface(const GLIB_Surface *pSurface, const GLIB_Rectangle *pRect)
+{
+  /* Check arguments */
+  if (pSurface == NULL) return GLIB_INVALID_ARGUMENT;
+
+  EMSTATUS status;
+  GLIB_Rectangle rect = pSurface->area;
+
+  if (pRect != NULL)
+  {
+    if ((pRect->xMin > pRect->xMax) || (pRect->yMin > pRect->yMax)) return GLIB_INVALID_ARGUMENT;
+
+    /* Intersect the corners directly, a full-range rectangle has no 16 bit size */
+    if (pRect->xMin > rect.xMin) rect.xMin = pRect->xMin;
+    if (pRect->yMin > rect.yMin) rect.yMin = pRect->yMin;
+    if (pRect->xMax < rect.xMax) rect.xMax = pRect->xMax;
+    if (pRect->yMax < rect.yMax) rect.yMax = pRect->yMax;
+    if ((rect.xMin > rect.xMax) || (rect.yMin > rect.yMax)) return GLIB_OK;
+  }
+
+  uint32_t width  = (uint32_t) rect.xMax - rect.xMin + 1;
+  uint32_t height = (uint32_t) rect.yMax - rect.yMin + 1;
+  const uint16_t *row = pSurface->pixels +
+                        (uint32_t) (rect.yMin - pSurface->area.yMin) * pSurface->stride +
+                        (rect.xMin - pSurface->area.xMin);
+  uint32_t yPos;
+
+  status = DMD_setClippingArea(rect.xMin, rect.yMin, width, height);
+  if (status != DMD_OK) return status;
+
+  if (width == pSurface->stride)
+  {
+    /* The rows are contiguous in memory */
+    status = DMD_writeDataRGB565(0, 0, row, width * height);
+    if (status != DMD_OK) return status;
+  }
+  else
+  {
+    /* Each row continues where the previous one left the address counter */
+    for (yPos = 0; yPos < height; yPos++)
+    {
+      status = DMD_writeDataRGB565(0, yPos, row, width);
+      if (status != DMD_OK) return status;
+      row += pSurface->stride;
+    }
+  }
+
+  /* Reset display clipping area to the whole display */
+  DMD_DisplayGeometry *pGeometry;
+  status = DMD_getDisplayGeometry(&pGeometry);
+  if (status != DMD_OK) return status;
+
+  return DMD_setClippingArea(0, 0, pGeometry->xSize, pGeometry->ySize);
+}
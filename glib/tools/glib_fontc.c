@@ -0,0 +1,488 @@
+ /*************************************************************************//**
+ * @file glib_fontc.c
+ * @brief Energy Micro Graphics Library: Font Compiler
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+/* Host tool that converts a font strip into the layouts used by GLIB.
+ *
+ * The input is an XBM image, or a C header in the same form such as
+ * glib_font.h: "#define <name>_width", "#define <name>_height" and an array
+ * "<name>[]" of hex bytes. The glyphs are stored side by side in the strip,
+ * starting with the character given by -first (default ' '). By default all
+ * glyphs that fit in the strip are converted, -count converts fewer.
+ *
+ * Build and run on the host:
+ *   cc -o glib_fontc glib_fontc.c
+ *   glib_fontc [-rle | -aa <scale>] [-first <char code>] [-count <glyphs>]
+ *              <strip.h> <glyph width> <name>
+ *
+ * Without -rle, a glyph-major table is written: the rows of each glyph are
+ * stored next to each other, ceil(width / 8) bytes per row with the leftmost
+ * pixel in the LSB, and packed little-endian into uint32_t words. The words
+ * of glyph c start at index (c - first) * <name>_WORDS_PER_GLYPH.
+ *
+ * With -rle, a GLIB_Font is written with the bitmap of each glyph trimmed to
+ * its set pixels and packed as runs, see GLIB_Font in glib.h. The advance of
+ * every glyph is the glyph width of the strip.
+ *
+ * With -aa, the strip is drawn <scale> times larger than the font, and a
+ * 4 bits per pixel GLIB_Font is written. The coverage of each pixel is the
+ * share of set strip pixels in its <scale> x <scale> block. The glyph width
+ * is given in strip pixels. */
+
+/* Standard C header files */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Largest strip that can be read */
+#define MAX_STRIP_BYTES    (1 << 20)
+
+/* Strip read from the input file */
+static uint8_t  strip[MAX_STRIP_BYTES];
+static uint32_t stripBytes;
+static uint32_t stripWidth;
+static uint32_t stripHeight;
+
+/* Local function prototypes */
+static int readStrip(const char *fileName);
+static int getPixel(uint32_t glyph, uint32_t glyphWidth, uint32_t x, uint32_t y);
+static void writeGlyphMajor(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                            uint32_t first);
+static uint32_t getCoverage(uint32_t glyph, uint32_t glyphWidth, uint32_t scale,
+                            uint32_t x, uint32_t y);
+static void trimGlyph(uint32_t glyph, uint32_t glyphWidth, uint32_t scale, int32_t box[4]);
+static uint32_t packRuns(uint32_t glyph, uint32_t glyphWidth, const int32_t box[4],
+                         int print);
+static void writeRle(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                     uint32_t first);
+static uint32_t packCoverage(uint32_t glyph, uint32_t glyphWidth, uint32_t scale,
+                             const int32_t box[4], int print);
+static void writeCoverage(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                          uint32_t first, uint32_t scale);
+
+/**************************************************************************//**
+*  @brief
+*  Reads the size and the pixel bytes of a strip
+*
+*  @return
+*  Returns 0 on success, otherwise -1
+******************************************************************************/
+static int readStrip(const char *fileName)
+{
+  static char text[8 * MAX_STRIP_BYTES];
+  FILE        *file;
+  size_t      length;
+  char        *pos;
+  char        *end;
+
+  file = fopen(fileName, "r");
+  if (file == NULL) return -1;
+  length       = fread(text, 1, sizeof(text) - 1, file);
+  text[length] = '\0';
+  fclose(file);
+
+  /* The size is given by the first _width and _height defines */
+  pos = strstr(text, "_width");
+  if (pos == NULL) return -1;
+  stripWidth = strtoul(pos + strlen("_width"), NULL, 0);
+  pos = strstr(text, "_height");
+  if (pos == NULL) return -1;
+  stripHeight = strtoul(pos + strlen("_height"), NULL, 0);
+
+  /* The pixel bytes follow the first opening brace */
+  pos = strchr(text, '{');
+  if (pos == NULL) return -1;
+  stripBytes = 0;
+  while (stripBytes < MAX_STRIP_BYTES)
+  {
+    pos = strstr(pos, "0x");
+    if (pos == NULL) break;
+    strip[stripBytes++] = (uint8_t) strtoul(pos, &end, 16);
+    pos = end;
+  }
+
+  if (stripBytes < ((stripWidth + 7) / 8) * stripHeight) return -1;
+
+  return 0;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns 1 if a pixel of a glyph is set in the strip
+******************************************************************************/
+static int getPixel(uint32_t glyph, uint32_t glyphWidth, uint32_t x, uint32_t y)
+{
+  uint32_t stripX = glyph * glyphWidth + x;
+
+  return (strip[y * ((stripWidth + 7) / 8) + stripX / 8] >> (stripX % 8)) & 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the glyph-major table
+******************************************************************************/
+static void writeGlyphMajor(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                            uint32_t first)
+{
+  uint32_t rowBytes      = (glyphWidth + 7) / 8;
+  uint32_t wordsPerGlyph = (rowBytes * stripHeight + 3) / 4;
+  uint32_t glyph, word, byte, bit, x;
+  uint32_t value;
+
+  printf("#define %s_WIDTH            %u\n", name, glyphWidth);
+  printf("#define %s_HEIGHT           %u\n", name, stripHeight);
+  printf("#define %s_FIRST_CHAR       %u\n", name, first);
+  printf("#define %s_NUM_GLYPHS       %u\n", name, numGlyphs);
+  printf("#define %s_WORDS_PER_GLYPH  %u\n\n", name, wordsPerGlyph);
+  printf("static const uint32_t %s[] = {\n", name);
+
+  for (glyph = 0; glyph < numGlyphs; glyph++)
+  {
+    printf("  /* '%c' */", (char) (first + glyph));
+    for (word = 0; word < wordsPerGlyph; word++)
+    {
+      value = 0;
+      for (byte = 0; byte < 4; byte++)
+      {
+        /* Byte number (word * 4 + byte) of the glyph is byte (n % rowBytes)
+         * of row (n / rowBytes) */
+        uint32_t n = word * 4 + byte;
+        if (n / rowBytes >= stripHeight) break;
+        for (bit = 0; bit < 8; bit++)
+        {
+          x = (n % rowBytes) * 8 + bit;
+          if ((x < glyphWidth) && getPixel(glyph, glyphWidth, x, n / rowBytes))
+          {
+            value |= 1u << (byte * 8 + bit);
+          }
+        }
+      }
+      printf(" 0x%08x,", value);
+    }
+    printf("\n");
+  }
+
+  printf("};\n");
+}
+
+/**************************************************************************//**
+*  @brief
+*  Returns the coverage 0..15 of a font pixel, from the block of
+*  scale x scale strip pixels that it is drawn from
+******************************************************************************/
+static uint32_t getCoverage(uint32_t glyph, uint32_t glyphWidth, uint32_t scale,
+                            uint32_t x, uint32_t y)
+{
+  uint32_t set = 0;
+  uint32_t i, j;
+
+  for (j = 0; j < scale; j++)
+  {
+    for (i = 0; i < scale; i++)
+    {
+      set += getPixel(glyph, glyphWidth, x * scale + i, y * scale + j);
+    }
+  }
+
+  return (set * 15 + scale * scale / 2) / (scale * scale);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Finds the smallest box that holds the covered pixels of a glyph. The box
+*  is empty (xMax < xMin) if no pixel is covered.
+******************************************************************************/
+static void trimGlyph(uint32_t glyph, uint32_t glyphWidth, uint32_t scale, int32_t box[4])
+{
+  uint32_t x, y;
+
+  box[0] = glyphWidth / scale;
+  box[1] = stripHeight / scale;
+  box[2] = -1;
+  box[3] = -1;
+
+  for (y = 0; y < stripHeight / scale; y++)
+  {
+    for (x = 0; x < glyphWidth / scale; x++)
+    {
+      if (getCoverage(glyph, glyphWidth, scale, x, y) == 0) continue;
+      if ((int32_t) x < box[0]) box[0] = x;
+      if ((int32_t) y < box[1]) box[1] = y;
+      if ((int32_t) x > box[2]) box[2] = x;
+      if ((int32_t) y > box[3]) box[3] = y;
+    }
+  }
+
+  if (box[2] < 0)
+  {
+    box[0] = 0;
+    box[1] = 0;
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Packs the box of a glyph as alternating runs, starting with a clear run
+*
+*  @param print
+*  If 1, the run bytes are written to stdout
+*
+*  @return
+*  Returns the number of run bytes
+******************************************************************************/
+static uint32_t packRuns(uint32_t glyph, uint32_t glyphWidth, const int32_t box[4],
+                         int print)
+{
+  uint32_t bytes   = 0;
+  uint32_t run     = 0;
+  int      current = 0;
+  int32_t  x, y;
+
+  if (box[2] < box[0]) return 0;
+
+  for (y = box[1]; y <= box[3]; y++)
+  {
+    for (x = box[0]; x <= box[2]; x++)
+    {
+      if (getPixel(glyph, glyphWidth, x, y) != current)
+      {
+        if (print) printf(" %u,", run);
+        bytes++;
+        current = !current;
+        run     = 0;
+      }
+      else if (run == 255)
+      {
+        /* Continue the run after a zero length run of the other kind */
+        if (print) printf(" 255, 0,");
+        bytes += 2;
+        run    = 0;
+      }
+      run++;
+    }
+  }
+
+  if (print) printf(" %u,", run);
+
+  return bytes + 1;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the glyph table and packed runs of a GLIB_Font
+******************************************************************************/
+static void writeRle(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                     uint32_t first)
+{
+  uint32_t offset = 0;
+  uint32_t glyph;
+  int32_t  box[4];
+
+  printf("static const uint8_t %sData[] = {\n", name);
+  for (glyph = 0; glyph < numGlyphs; glyph++)
+  {
+    printf("  /* '%c' */", (char) (first + glyph));
+    trimGlyph(glyph, glyphWidth, 1, box);
+    packRuns(glyph, glyphWidth, box, 1);
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("static const GLIB_Glyph %sGlyphs[] = {\n", name);
+  for (glyph = 0; glyph < numGlyphs; glyph++)
+  {
+    trimGlyph(glyph, glyphWidth, 1, box);
+    printf("  { %5u, %2d, %2d, %2d, %2d, %2u }, /* '%c' */\n", offset,
+           box[2] - box[0] + 1, box[3] - box[1] + 1, box[0], box[1], glyphWidth,
+           (char) (first + glyph));
+    offset += packRuns(glyph, glyphWidth, box, 0);
+  }
+  printf("};\n\n");
+
+  printf("static const GLIB_Font %s = {\n", name);
+  printf("  %sGlyphs, %sData, NULL, 0, %u, %u, %u, 2, 1\n", name, name,
+         first, first + numGlyphs - 1, stripHeight);
+  printf("};\n");
+}
+
+/**************************************************************************//**
+*  @brief
+*  Packs the box of a glyph as rows of 4 bit coverage values, with the
+*  leftmost pixel of a byte in the low nibble
+*
+*  @param print
+*  If 1, the bytes are written to stdout
+*
+*  @return
+*  Returns the number of bytes
+******************************************************************************/
+static uint32_t packCoverage(uint32_t glyph, uint32_t glyphWidth, uint32_t scale,
+                             const int32_t box[4], int print)
+{
+  uint32_t bytes = 0;
+  uint32_t value;
+  int32_t  x, y;
+
+  if (box[2] < box[0]) return 0;
+
+  for (y = box[1]; y <= box[3]; y++)
+  {
+    for (x = box[0]; x <= box[2]; x += 2)
+    {
+      value = getCoverage(glyph, glyphWidth, scale, x, y);
+      if (x + 1 <= box[2]) value |= getCoverage(glyph, glyphWidth, scale, x + 1, y) << 4;
+      if (print) printf(" 0x%02x,", value);
+      bytes++;
+    }
+  }
+
+  return bytes;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Writes the glyph table and coverage rows of an anti-aliased GLIB_Font
+******************************************************************************/
+static void writeCoverage(const char *name, uint32_t glyphWidth, uint32_t numGlyphs,
+                          uint32_t first, uint32_t scale)
+{
+  uint32_t offset = 0;
+  uint32_t glyph;
+  int32_t  box[4];
+
+  printf("static const uint8_t %sData[] = {\n", name);
+  for (glyph = 0; glyph < numGlyphs; glyph++)
+  {
+    printf("  /* '%c' */", (char) (first + glyph));
+    trimGlyph(glyph, glyphWidth, scale, box);
+    packCoverage(glyph, glyphWidth, scale, box, 1);
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("static const GLIB_Glyph %sGlyphs[] = {\n", name);
+  for (glyph = 0; glyph < numGlyphs; glyph++)
+  {
+    trimGlyph(glyph, glyphWidth, scale, box);
+    printf("  { %5u, %2d, %2d, %2d, %2d, %2u }, /* '%c' */\n", offset,
+           box[2] - box[0] + 1, box[3] - box[1] + 1, box[0], box[1], glyphWidth / scale,
+           (char) (first + glyph));
+    offset += packCoverage(glyph, glyphWidth, scale, box, 0);
+  }
+  printf("};\n\n");
+
+  printf("static const GLIB_Font %s = {\n", name);
+  printf("  %sGlyphs, %sData, NULL, 0, %u, %u, %u, 2, 4\n", name, name,
+         first, first + numGlyphs - 1, stripHeight / scale);
+  printf("};\n");
+}
+
+int main(int argc, char *argv[])
+{
+  int      rle   = 0;
+  uint32_t first = ' ';
+  uint32_t count = 0;
+  uint32_t scale = 0;
+  uint32_t glyphWidth;
+  int      arg   = 1;
+
+  while ((arg < argc) && (argv[arg][0] == '-'))
+  {
+    if (strcmp(argv[arg], "-rle") == 0)
+    {
+      rle = 1;
+    }
+    else if ((strcmp(argv[arg], "-aa") == 0) && (arg + 1 < argc))
+    {
+      scale = strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-first") == 0) && (arg + 1 < argc))
+    {
+      first = strtoul(argv[++arg], NULL, 0);
+    }
+    else if ((strcmp(argv[arg], "-count") == 0) && (arg + 1 < argc))
+    {
+      count = strtoul(argv[++arg], NULL, 0);
+    }
+    else
+    {
+      break;
+    }
+    arg++;
+  }
+
+  if (argc - arg != 3)
+  {
+    fprintf(stderr, "usage: %s [-rle | -aa <scale>] [-first <char code>] [-count <glyphs>] "
+            "<strip.h> <glyph width> <name>\n", argv[0]);
+    return 1;
+  }
+
+  if (readStrip(argv[arg]) != 0)
+  {
+    fprintf(stderr, "%s: cannot read strip\n", argv[arg]);
+    return 1;
+  }
+
+  glyphWidth = strtoul(argv[arg + 1], NULL, 0);
+  if (scale == 0) scale = 1;
+  if ((glyphWidth < scale) || (glyphWidth / scale > 255) || (stripHeight / scale > 255))
+  {
+    fprintf(stderr, "invalid glyph size\n");
+    return 1;
+  }
+
+  if ((count == 0) || (count > stripWidth / glyphWidth)) count = stripWidth / glyphWidth;
+  if (first + count > 256)
+  {
+    fprintf(stderr, "too many glyphs\n");
+    return 1;
+  }
+
+  printf("/* Generated by glib_fontc from %s */\n\n", argv[arg]);
+  if (scale > 1)
+  {
+    writeCoverage(argv[arg + 2], glyphWidth, count, first, scale);
+  }
+  else if (rle)
+  {
+    writeRle(argv[arg + 2], glyphWidth, count, first);
+  }
+  else
+  {
+    writeGlyphMajor(argv[arg + 2], glyphWidth, count, first);
+  }
+
+  return 0;
+}
@@ -0,0 +1,462 @@
+ /*************************************************************************//**
+ * @file glib_simcheck.c
+ * @brief Energy Micro Graphics Library: Regression Checks on the SSD2119 Simulator
+ * @author Energy Micro AS
+ ******************************************************************************
+ * @section License
+ * <b>(C) Copyright 2012 Energy Micro AS, http://www.energymicro.com</b>
+ ******************************************************************************
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ * 4. The source and compiled code may only be used on Energy Micro "EFM32"
+ *    microcontrollers and "EFR4" radios.
+ *
+ * DISCLAIMER OF WARRANTY/LIMITATION OF REMEDIES: Energy Micro AS has no
+ * obligation to support this Software. Energy Micro AS is providing the
+ * Software "AS IS", with no express or implied warranties of any kind,
+ * including, but not limited to, any implied warranties of merchantability
+ * or fitness for any particular purpose or warranties against infringement
+ * of any proprietary rights of a third party.
+ *
+ * Energy Micro AS will not be liable for any consequential, incidental, or
+ * special damages, or any other relief, or for any claim by any third party,
+ * arising from your use of this Software.
+ *
+ *****************************************************************************/
+
+
+/* Host program that draws through GLIB into the in-memory SSD2119 model of
+ * dmdif_ssd2119_sim.c and checks that the different ways of getting pixels
+ * to the display agree with each other:
+ *
+ * - A scene drawn directly to the display, drawn to a surface and flushed,
+ *   and drawn in bands and tiles gives the same graphics RAM
+ * - A display list of the scene replays to the same graphics RAM, directly
+ *   and in bands, and its checksum does not depend on the unused contents of
+ *   the list buffer
+ * - Flushing the dirty region of a surface brings the display up to date
+ * - Wrapped text layout lines neither start nor end with the spaces they
+ *   were wrapped at
+ *
+ * Build and run on the host, from this directory:
+ *   cc -I../.. -I.. -I../../dmd/ssd2119 -o glib_simcheck glib_simcheck.c ../glib*.c
+ *      ../../dmd/ssd2119/dmd_ssd2119_16bit.c ../../dmd/ssd2119/dmdif_ssd2119_sim.c
+ *   glib_simcheck
+ *
+ * The 18 bits per pixel driver dmd_ssd2119.c can be linked instead of
+ * dmd_ssd2119_16bit.c. The failing checks are printed, and the exit status
+ * is 1 if any failed. */
+
+/* Standard C header files */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* GLIB and display driver header files */
+#include "glib.h"
+#include "dmd_ssd2119.h"
+#include "dmdif_ssd2119_sim.h"
+
+/* Size of the band buffer, in pixels */
+#define BAND_PIXELS        (DMD_HORIZONTAL_SIZE * 16)
+
+/* Size of the display list buffers, in uint16_t */
+#define LIST_SIZE          2048
+
+/* Buffers shared by the checks */
+static uint16_t frame[DMD_HORIZONTAL_SIZE * DMD_VERTICAL_SIZE];
+static uint16_t band[BAND_PIXELS];
+static uint16_t list[LIST_SIZE];
+static uint16_t otherList[LIST_SIZE];
+static uint8_t  bitmap[20 * 10 * 3];
+
+/* Strings of the scene, odd lengths leave a pad byte in a display list */
+static char     title[]   = "Hello, World!";
+static char     clipped[] = "Clipped text";
+
+/* Polygon of the scene, closed by repeating the first point */
+static const uint16_t polygon[] = { 20, 200, 60, 150, 90, 230, 20, 200 };
+
+/* Number of failed checks */
+static uint32_t failures;
+
+/* Local function prototypes */
+static void check(uint32_t passed, const char *name);
+static uint32_t hashGram(void);
+static uint32_t gramMismatches(const uint16_t *pixels);
+static EMSTATUS drawScene(GLIB_Context *pContext, void *pUser);
+static void recordScene(GLIB_DisplayList *pList, GLIB_Context *pContext);
+static uint32_t drawReference(GLIB_Context *pContext);
+static void checkSurface(GLIB_Context *pContext, uint32_t reference);
+static void checkBands(GLIB_Context *pContext, uint32_t reference);
+static void checkDisplayList(GLIB_Context *pContext, uint32_t reference);
+static void checkDirty(GLIB_Context *pContext);
+static void checkLayout(void);
+
+/**************************************************************************//**
+*  @brief
+*  Counts and prints a failed check
+*
+*  @param passed
+*  Nonzero if the check passed
+*  @param name
+*  Name of the check
+******************************************************************************/
+static void check(uint32_t passed, const char *name)
+{
+  if (passed) return;
+
+  printf("FAIL: %s\n", name);
+  failures++;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Hashes the graphics RAM of the simulated controller. The pixels are
+*  reduced to RGB565, the format of surfaces, so that the hash does not
+*  depend on the color depth of the driver.
+*
+*  @return
+*  FNV-1a hash of all pixels
+******************************************************************************/
+static uint32_t hashGram(void)
+{
+  uint32_t hash = 2166136261u;
+  uint16_t x;
+  uint16_t y;
+  uint8_t  red;
+  uint8_t  green;
+  uint8_t  blue;
+
+  for (y = 0; y < DMD_VERTICAL_SIZE; y++)
+  {
+    for (x = 0; x < DMD_HORIZONTAL_SIZE; x++)
+    {
+      DMDIF_simGetPixelRGB(x, y, &red, &green, &blue);
+      hash ^= ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3);
+      hash *= 16777619u;
+    }
+  }
+
+  return hash;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Compares the graphics RAM with a full screen of RGB565 pixels
+*
+*  @return
+*  Number of pixels that differ
+******************************************************************************/
+static uint32_t gramMismatches(const uint16_t *pixels)
+{
+  uint32_t mismatches = 0;
+  uint16_t pixel;
+  uint16_t x;
+  uint16_t y;
+  uint8_t  red;
+  uint8_t  green;
+  uint8_t  blue;
+
+  for (y = 0; y < DMD_VERTICAL_SIZE; y++)
+  {
+    for (x = 0; x < DMD_HORIZONTAL_SIZE; x++)
+    {
+      DMDIF_simGetPixelRGB(x, y, &red, &green, &blue);
+      pixel = pixels[y * DMD_HORIZONTAL_SIZE + x];
+      if (((red >> 3) != (pixel >> 11)) ||
+          ((green >> 2) != ((pixel >> 5) & 0x3f)) ||
+          ((blue >> 3) != (pixel & 0x1f)))
+      {
+        mismatches++;
+      }
+    }
+  }
+
+  return mismatches;
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the scene the checks compare. It has the signature of a
+*  GLIB_DrawFunction so that it can be rendered in bands.
+*
+*  Antialiased lines are left out, as they blend differently on the display
+*  and on a surface.
+******************************************************************************/
+static EMSTATUS drawScene(GLIB_Context *pContext, void *pUser)
+{
+  GLIB_Rectangle filled  = { 10, 10, 60, 40 };
+  GLIB_Rectangle outline = { 5, 50, 100, 90 };
+  GLIB_Rectangle clip    = { 150, 150, 220, 220 };
+  uint16_t       i;
+
+  (void) pUser;
+
+  pContext->backgroundColor = 0x102030;
+  GLIB_clear(pContext);
+
+  pContext->foregroundColor = 0xFF8040;
+  GLIB_drawRectFilled(pContext, &filled);
+  for (i = 0; i < 20; i++)
+  {
+    pContext->foregroundColor = 0x123456 * i;
+    GLIB_drawLine(pContext, 160, 120, (i * 37) % 320, (i * 53) % 240);
+  }
+
+  pContext->foregroundColor = 0xFFFFFF;
+  GLIB_drawCircle(pContext, 200, 60, 40);
+  GLIB_drawCircleFilled(pContext, 250, 180, 30);
+  GLIB_drawPartialCircle(pContext, 100, 180, 25, 0x0F);
+  GLIB_drawArc(pContext, 300, 20, 35, 30, 300);
+  GLIB_drawString(pContext, title, sizeof(title) - 1, 5, 100, 1);
+  GLIB_drawRect(pContext, &outline);
+  GLIB_drawBitmap(pContext, 280, 5, 20, 10, bitmap);
+  GLIB_drawPolygonFilled(pContext, 4, polygon, GLIB_FILL_EVEN_ODD);
+  GLIB_drawTriangleFilled(pContext, 120, 230, 140, 200, 170, 235);
+
+  /* Part of the scene is drawn under a clipping region */
+  GLIB_setClippingRegion(pContext, &clip);
+  pContext->foregroundColor = 0x00FF00;
+  GLIB_drawCircleFilled(pContext, 160, 200, 40);
+  GLIB_drawString(pContext, clipped, sizeof(clipped) - 1, 140, 160, 0);
+
+  return GLIB_resetClippingRegion(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records the scene of drawScene() in a display list
+******************************************************************************/
+static void recordScene(GLIB_DisplayList *pList, GLIB_Context *pContext)
+{
+  GLIB_Rectangle filled  = { 10, 10, 60, 40 };
+  GLIB_Rectangle outline = { 5, 50, 100, 90 };
+  GLIB_Rectangle clip    = { 150, 150, 220, 220 };
+  uint16_t       i;
+
+  GLIB_displayListReset(pList);
+
+  pContext->backgroundColor = 0x102030;
+  GLIB_displayListClear(pList, pContext);
+
+  pContext->foregroundColor = 0xFF8040;
+  GLIB_displayListDrawRectFilled(pList, pContext, &filled);
+  for (i = 0; i < 20; i++)
+  {
+    pContext->foregroundColor = 0x123456 * i;
+    GLIB_displayListDrawLine(pList, pContext, 160, 120, (i * 37) % 320, (i * 53) % 240);
+  }
+
+  pContext->foregroundColor = 0xFFFFFF;
+  GLIB_displayListDrawCircle(pList, pContext, 200, 60, 40);
+  GLIB_displayListDrawCircleFilled(pList, pContext, 250, 180, 30);
+  GLIB_displayListDrawPartialCircle(pList, pContext, 100, 180, 25, 0x0F);
+  GLIB_displayListDrawArc(pList, pContext, 300, 20, 35, 30, 300);
+  GLIB_displayListDrawString(pList, pContext, title, sizeof(title) - 1, 5, 100, 1);
+  GLIB_displayListDrawRect(pList, pContext, &outline);
+  GLIB_displayListDrawBitmap(pList, pContext, 280, 5, 20, 10, bitmap);
+  GLIB_displayListDrawPolygonFilled(pList, pContext, 4, polygon, GLIB_FILL_EVEN_ODD);
+  GLIB_displayListDrawTriangleFilled(pList, pContext, 120, 230, 140, 200, 170, 235);
+
+  GLIB_setClippingRegion(pContext, &clip);
+  pContext->foregroundColor = 0x00FF00;
+  GLIB_displayListDrawCircleFilled(pList, pContext, 160, 200, 40);
+  GLIB_displayListDrawString(pList, pContext, clipped, sizeof(clipped) - 1, 140, 160, 0);
+
+  GLIB_resetClippingRegion(pContext);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the scene directly to the display
+*
+*  @return
+*  Hash of the graphics RAM, which the other ways of drawing must reproduce
+******************************************************************************/
+static uint32_t drawReference(GLIB_Context *pContext)
+{
+  DMD_init(0, 0);
+  check(drawScene(pContext, NULL) == GLIB_OK, "draw scene");
+
+  return hashGram();
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws the scene to a full screen surface and flushes it
+******************************************************************************/
+static void checkSurface(GLIB_Context *pContext, uint32_t reference)
+{
+  GLIB_Rectangle screen = { 0, 0, DMD_HORIZONTAL_SIZE - 1, DMD_VERTICAL_SIZE - 1 };
+  GLIB_Surface   surface;
+
+  DMD_init(0, 0);
+  GLIB_surfaceInit(&surface, frame, DMD_HORIZONTAL_SIZE, &screen);
+  GLIB_setSurface(pContext, &surface);
+  drawScene(pContext, NULL);
+  GLIB_setSurface(pContext, NULL);
+
+  check(GLIB_flushSurface(&surface, NULL) == GLIB_OK, "surface flush");
+  check(hashGram() == reference, "surface matches direct drawing");
+}
+
+/**************************************************************************//**
+*  @brief
+*  Renders the scene in full width bands and in tiles
+******************************************************************************/
+static void checkBands(GLIB_Context *pContext, uint32_t reference)
+{
+  DMD_init(0, 0);
+  check(GLIB_renderBands(pContext, NULL, band, 0, 16, drawScene, NULL) == GLIB_OK,
+        "render bands");
+  check(hashGram() == reference, "bands match direct drawing");
+
+  DMD_init(0, 0);
+  check(GLIB_renderBands(pContext, NULL, band, 50, 30, drawScene, NULL) == GLIB_OK,
+        "render tiles");
+  check(hashGram() == reference, "tiles match direct drawing");
+}
+
+/**************************************************************************//**
+*  @brief
+*  Records the scene in a display list and replays it directly and in bands
+******************************************************************************/
+static void checkDisplayList(GLIB_Context *pContext, uint32_t reference)
+{
+  GLIB_DisplayList displayList;
+  GLIB_DisplayList otherDisplayList;
+
+  /* The checksum must only depend on the recorded commands */
+  memset(list, 0x11, sizeof(list));
+  memset(otherList, 0xEE, sizeof(otherList));
+  GLIB_displayListInit(&displayList, list, LIST_SIZE);
+  GLIB_displayListInit(&otherDisplayList, otherList, LIST_SIZE);
+  recordScene(&displayList, pContext);
+  recordScene(&otherDisplayList, pContext);
+  check(GLIB_displayListChecksum(&displayList) ==
+        GLIB_displayListChecksum(&otherDisplayList),
+        "display list checksum ignores unused buffer contents");
+
+  DMD_init(0, 0);
+  check(GLIB_displayListDraw(pContext, &displayList) == GLIB_OK, "display list replay");
+  check(hashGram() == reference, "display list matches direct drawing");
+
+  DMD_init(0, 0);
+  check(GLIB_renderBands(pContext, NULL, band, 0, 16, GLIB_displayListDraw,
+                         &displayList) == GLIB_OK,
+        "display list in bands");
+  check(hashGram() == reference, "display list in bands matches direct drawing");
+}
+
+/**************************************************************************//**
+*  @brief
+*  Draws to a surface that tracks a dirty region, and checks that flushing
+*  the dirty region leaves the display equal to the surface
+******************************************************************************/
+static void checkDirty(GLIB_Context *pContext)
+{
+  GLIB_Rectangle    screen = { 0, 0, DMD_HORIZONTAL_SIZE - 1, DMD_VERTICAL_SIZE - 1 };
+  GLIB_Rectangle    edge   = { 300, 220, 340, 260 };
+  GLIB_Surface      surface;
+  GLIB_DirtyRegion  dirty;
+
+  DMD_init(0, 0);
+  GLIB_surfaceInit(&surface, frame, DMD_HORIZONTAL_SIZE, &screen);
+  GLIB_setSurface(pContext, &surface);
+  GLIB_dirtyInit(&dirty);
+  GLIB_setDirtyRegion(pContext, &dirty);
+
+  /* The scene starts by clearing, which dirties the whole surface */
+  drawScene(pContext, NULL);
+  check(GLIB_flushDirty(pContext) == GLIB_OK, "dirty flush of the scene");
+  check(gramMismatches(frame) == 0, "display matches surface after the scene");
+
+  /* Small updates spread over the surface only dirty what they draw */
+  pContext->foregroundColor = 0xFF0000;
+  GLIB_drawString(pContext, title, sizeof(title) - 1, 20, 20, 1);
+  GLIB_drawString(pContext, clipped, sizeof(clipped) - 1, 200, 100, 0);
+  GLIB_drawLine(pContext, 160, 200, 190, 170);
+  GLIB_drawLineAA(pContext, 30, 120, 90, 140);
+  GLIB_drawCircle(pContext, 60, 200, 12);
+  GLIB_drawRectFilled(pContext, &edge);
+  check(GLIB_flushDirty(pContext) == GLIB_OK, "dirty flush of the updates");
+  check(gramMismatches(frame) == 0, "display matches surface after the updates");
+
+  GLIB_setDirtyRegion(pContext, NULL);
+  GLIB_setSurface(pContext, NULL);
+}
+
+/**************************************************************************//**
+*  @brief
+*  Wraps text with runs of spaces and checks the lines
+******************************************************************************/
+static void checkLayout(void)
+{
+  static const char text[] = "and   then  more text,   wrapped    at   runs of spaces";
+  GLIB_Rectangle    box    = { 0, 0, 95, 200 };
+  GLIB_TextLayout   layout;
+  GLIB_TextLine     lines[16];
+  const GLIB_TextLine *pLine;
+  uint16_t          width;
+  uint16_t          height;
+  uint16_t          i;
+
+  GLIB_textLayoutInit(&layout, lines, 16);
+  check(GLIB_textLayoutSet(&layout, NULL, text, sizeof(text) - 1, &box) == GLIB_OK,
+        "text layout");
+  check(layout.numLines > 1, "text layout wraps");
+
+  for (i = 0; i < layout.numLines; i++)
+  {
+    pLine = &lines[i];
+    check((pLine->length > 0) &&
+          (text[pLine->start] != ' ') &&
+          (text[pLine->start + pLine->length - 1] != ' '),
+          "layout lines do not start or end with spaces");
+
+    GLIB_measureString(NULL, text + pLine->start, pLine->length, &width, &height);
+    check((pLine->width == width) && (width <= box.xMax - box.xMin + 1),
+          "layout line width is the width of its chars");
+  }
+}
+
+/**************************************************************************//**
+*  @brief
+*  Runs the checks
+******************************************************************************/
+int main(void)
+{
+  GLIB_Context context;
+  uint32_t     reference;
+  uint32_t     i;
+
+  for (i = 0; i < sizeof(bitmap); i++) bitmap[i] = (uint8_t) (i * 7);
+
+  DMD_init(0, 0);
+  GLIB_contextInit(&context);
+
+  reference = drawReference(&context);
+  checkSurface(&context, reference);
+  checkBands(&context, reference);
+  checkDisplayList(&context, reference);
+  checkDirty(&context);
+  checkLayout();
+
+  if (failures != 0)
+  {
+    printf("%u checks failed\n", (unsigned) failures);
+    return 1;
+  }
+
+  printf("All checks passed\n");
+  return 0;
+}